@@ -1,1752 +1,8044 @@
-#include <iostream>
-#include <vector>
-#include <queue>
-#include <unordered_map>
-#include <algorithm>
-#include <string>
-#include <ctime>
-#include <climits>
-#include <iomanip>
-#include <sstream>
-
-using namespace std;
-
-// ==================== COLOR CODES FOR CONSOLE ====================
-#define RESET   "\033[0m"
-#define RED     "\033[31m"
-#define GREEN   "\033[32m"
-#define YELLOW  "\033[33m"
-#define BLUE    "\033[34m"
-#define MAGENTA "\033[35m"
-#define CYAN    "\033[36m"
-#define BOLD    "\033[1m"
-
-// ==================== DATA STRUCTURES ====================
-
-struct Homeless {
-    int id;
-    string name;
-    int age;
-    string gender;
-    int locationNodeID;
-    bool medicalNeed;
-    int priorityScore;
-    string complaint;
-    time_t reportedAt;
-    bool allocated;
-    int allocatedShelterID;
-};
-
-struct Shelter {
-    int id;
-    string name;
-    int nodeID;
-    int capacityTotal;
-    int capacityOccupied;
-    string contactNumber;
-    vector<int> allocatedPersonIDs;
-};
-
-struct Station {
-    int id;
-    string name;
-    int nodeID;
-};
-
-struct EmergencyCase {
-    int homelessID;
-    int priority;
-    time_t timeReported;
-    
-    bool operator<(const EmergencyCase& other) const {
-        return priority < other.priority; // Max heap
-    }
-};
-
-struct Edge {
-    int dest;
-    int weight;
-};
-
-struct Report {
-    string date;
-    int totalRegistered;
-    int totalAllocated;
-    int emergenciesHandled;
-    int sheltersAtCapacity;
-};
-
-// ==================== GLOBAL DATA ====================
-
-vector<vector<Edge>> graph;
-unordered_map<int, Homeless> homelessRecords;
-vector<Homeless> homelessList;
-vector<Shelter> shelters;
-vector<Station> stations;
-priority_queue<EmergencyCase> emergencyHeap;
-vector<Report> dailyReports;
-int nodeCount = 0;
-int nextHomelessID = 106;
-
-// ==================== UTILITY FUNCTIONS ====================
-
-void clearScreen() {
-    #ifdef _WIN32
-        system("cls");
-    #else
-        system("clear");
-    #endif
-}
-
-void pressEnterToContinue() {
-    cout << "\n" << CYAN << "Press Enter to continue..." << RESET;
-    cin.ignore();
-    cin.get();
-}
-
-void printHeader(const string& title) {
-    cout << "\n" << BOLD << CYAN;
-    cout << "╔════════════════════════════════════════════════════════════════╗\n";
-    cout << "║" << string(62, ' ') << "║\n";
-    cout << "║";
-    int padding = (62 - title.length()) / 2;
-    cout << string(padding, ' ') << title << string(62 - padding - title.length(), ' ') << "║\n";
-    cout << "║" << string(62, ' ') << "║\n";
-    cout << "╚════════════════════════════════════════════════════════════════╝\n";
-    cout << RESET;
-}
-
-void printSubHeader(const string& title) {
-    cout << "\n" << BOLD << YELLOW << "═══ " << title << " ═══" << RESET << "\n\n";
-}
-
-void printSuccess(const string& msg) {
-    cout << GREEN << "✓ " << msg << RESET << "\n";
-}
-
-void printError(const string& msg) {
-    cout << RED << "✗ " << msg << RESET << "\n";
-}
-
-void printWarning(const string& msg) {
-    cout << YELLOW << "⚠ " << msg << RESET << "\n";
-}
-
-void printInfo(const string& msg) {
-    cout << BLUE << "ℹ " << msg << RESET << "\n";
-}
-
-// ==================== ALGORITHM IMPLEMENTATIONS ====================
-
-// 1️⃣ DIJKSTRA'S ALGORITHM - Shortest Path
-// Time Complexity: O((V+E) log V)
-// Space Complexity: O(V)
-vector<int> dijkstra(int source) {
-    vector<int> dist(nodeCount, INT_MAX);
-    vector<bool> visited(nodeCount, false);
-    priority_queue<pair<int, int>, vector<pair<int, int>>, greater<pair<int, int>>> pq;
-    
-    dist[source] = 0;
-    pq.push({0, source});
-    
-    while (!pq.empty()) {
-        int u = pq.top().second;
-        pq.pop();
-        
-        if (visited[u]) continue;
-        visited[u] = true;
-        
-        for (const Edge& e : graph[u]) {
-            int v = e.dest;
-            int weight = e.weight;
-            if (dist[u] != INT_MAX && dist[u] + weight < dist[v]) {
-                dist[v] = dist[u] + weight;
-                pq.push({dist[v], v});
-            }
-        }
-    }
-    
-    return dist;
-}
-
-// 2️⃣ BREADTH-FIRST SEARCH (BFS)
-// Time Complexity: O(V + E)
-// Space Complexity: O(V)
-void traverseNearbyAreas(int stationNodeID) {
-    printSubHeader("BFS: Nearby Area Traversal");
-    
-    if (stationNodeID < 0 || stationNodeID >= nodeCount) {
-        printError("Invalid node ID!");
-        return;
-    }
-    
-    vector<bool> visited(nodeCount, false);
-    queue<int> q;
-    vector<int> traversalOrder;
-    
-    q.push(stationNodeID);
-    visited[stationNodeID] = true;
-    
-    while (!q.empty()) {
-        int node = q.front();
-        q.pop();
-        traversalOrder.push_back(node);
-        
-        for (const Edge& e : graph[node]) {
-            if (!visited[e.dest]) {
-                visited[e.dest] = true;
-                q.push(e.dest);
-            }
-        }
-    }
-    
-    cout << "Starting Node: " << stationNodeID << "\n";
-    cout << "Traversal Order: ";
-    for (int i = 0; i < traversalOrder.size(); i++) {
-        cout << traversalOrder[i];
-        if (i < traversalOrder.size() - 1) cout << " → ";
-    }
-    cout << "\n";
-    printSuccess("BFS traversal completed");
-}
-
-// 3️⃣ DEPTH-FIRST SEARCH (DFS)
-// Time Complexity: O(V + E)
-// Space Complexity: O(V)
-void dfsUtil(int node, vector<bool>& visited, vector<int>& dfsOrder) {
-    visited[node] = true;
-    dfsOrder.push_back(node);
-    
-    for (const Edge& e : graph[node]) {
-        if (!visited[e.dest]) {
-            dfsUtil(e.dest, visited, dfsOrder);
-        }
-    }
-}
-
-bool checkShelterConnectivity() {
-    printSubHeader("DFS: Shelter Network Connectivity Check");
-    
-    if (shelters.empty()) {
-        printWarning("No shelters registered in the system");
-        return true;
-    }
-    
-    vector<bool> visited(nodeCount, false);
-    vector<int> dfsOrder;
-    dfsUtil(shelters[0].nodeID, visited, dfsOrder);
-    
-    cout << "DFS Traversal from Shelter '" << shelters[0].name << "':\n";
-    for (int i = 0; i < dfsOrder.size(); i++) {
-        cout << dfsOrder[i];
-        if (i < dfsOrder.size() - 1) cout << " → ";
-    }
-    cout << "\n\n";
-    
-    bool allConnected = true;
-    cout << left << setw(25) << "Shelter Name" << setw(15) << "Node ID" << setw(15) << "Status\n";
-    cout << string(55, '-') << "\n";
-    
-    for (const Shelter& s : shelters) {
-        string status = visited[s.nodeID] ? GREEN "Connected" RESET : RED "UNREACHABLE" RESET;
-        cout << left << setw(25) << s.name << setw(15) << s.nodeID << setw(15) << status << "\n";
-        if (!visited[s.nodeID]) allConnected = false;
-    }
-    
-    if (allConnected) {
-        printSuccess("All shelters are connected in the network");
-    } else {
-        printError("Some shelters are unreachable - network has issues!");
-    }
-    
-    return allConnected;
-}
-
-// 4️⃣ HASHING - Fast Insert/Search
-// Time Complexity: O(1) average case
-// Space Complexity: O(n)
-bool addHomelessRecord(Homeless h) {
-    if (homelessRecords.find(h.id) != homelessRecords.end()) {
-        printError("Duplicate ID detected! Record already exists.");
-        return false;
-    }
-    
-    if (h.locationNodeID < 0 || h.locationNodeID >= nodeCount) {
-        printError("Invalid location node ID!");
-        return false;
-    }
-    
-    h.allocated = false;
-    h.allocatedShelterID = -1;
-    h.reportedAt = time(0);
-    h.priorityScore = 0; // Will be calculated
-    
-    homelessRecords[h.id] = h;
-    homelessList.push_back(h);
-    printSuccess("Record added successfully: " + h.name + " (ID: " + to_string(h.id) + ")");
-    return true;
-}
-
-Homeless* searchHomeless(int id) {
-    auto it = homelessRecords.find(id);
-    if (it != homelessRecords.end()) {
-        return &(it->second);
-    }
-    return nullptr;
-}
-
-bool isDuplicate(int id) {
-    return homelessRecords.find(id) != homelessRecords.end();
-}
-
-// 5️⃣ BINARY SEARCH
-// Time Complexity: O(log n)
-// Space Complexity: O(1)
-int binarySearchRecord(int id) {
-    vector<int> sortedIDs;
-    for (const auto& pair : homelessRecords) {
-        sortedIDs.push_back(pair.first);
-    }
-    sort(sortedIDs.begin(), sortedIDs.end());
-    
-    int left = 0, right = sortedIDs.size() - 1;
-    int comparisons = 0;
-    
-    while (left <= right) {
-        comparisons++;
-        int mid = left + (right - left) / 2;
-        if (sortedIDs[mid] == id) {
-            cout << "Binary Search: Found in " << comparisons << " comparisons\n";
-            return mid;
-        } else if (sortedIDs[mid] < id) {
-            left = mid + 1;
-        } else {
-            right = mid - 1;
-        }
-    }
-    cout << "Binary Search: Not found after " << comparisons << " comparisons\n";
-    return -1;
-}
-
-// 6️⃣ MERGE SORT - Sort Shelters by Capacity
-// Time Complexity: O(n log n)
-// Space Complexity: O(n)
-void merge(vector<Shelter>& arr, int left, int mid, int right) {
-    int n1 = mid - left + 1;
-    int n2 = right - mid;
-    
-    vector<Shelter> L(n1), R(n2);
-    for (int i = 0; i < n1; i++) L[i] = arr[left + i];
-    for (int i = 0; i < n2; i++) R[i] = arr[mid + 1 + i];
-    
-    int i = 0, j = 0, k = left;
-    while (i < n1 && j < n2) {
-        int availL = L[i].capacityTotal - L[i].capacityOccupied;
-        int availR = R[j].capacityTotal - R[j].capacityOccupied;
-        
-        if (availL >= availR) {
-            arr[k++] = L[i++];
-        } else {
-            arr[k++] = R[j++];
-        }
-    }
-    
-    while (i < n1) arr[k++] = L[i++];
-    while (j < n2) arr[k++] = R[j++];
-}
-
-void mergeSort(vector<Shelter>& arr, int left, int right) {
-    if (left < right) {
-        int mid = left + (right - left) / 2;
-        mergeSort(arr, left, mid);
-        mergeSort(arr, mid + 1, right);
-        merge(arr, left, mid, right);
-    }
-}
-
-void sortSheltersByCapacity() {
-    printSubHeader("Merge Sort: Sorting Shelters by Available Capacity");
-    
-    if (shelters.empty()) {
-        printWarning("No shelters to sort");
-        return;
-    }
-    
-    mergeSort(shelters, 0, shelters.size() - 1);
-    
-    cout << left << setw(5) << "Rank" << setw(25) << "Shelter Name" << setw(12) << "Total" 
-         << setw(12) << "Occupied" << setw(12) << "Available" << setw(12) << "Status\n";
-    cout << string(78, '-') << "\n";
-    
-    for (int i = 0; i < shelters.size(); i++) {
-        const Shelter& s = shelters[i];
-        int available = s.capacityTotal - s.capacityOccupied;
-        double utilization = (s.capacityOccupied * 100.0) / s.capacityTotal;
-        
-        string status;
-        if (utilization >= 90) status = RED "CRITICAL" RESET;
-        else if (utilization >= 75) status = YELLOW "HIGH" RESET;
-        else status = GREEN "NORMAL" RESET;
-        
-        cout << left << setw(5) << (i+1) << setw(25) << s.name 
-             << setw(12) << s.capacityTotal << setw(12) << s.capacityOccupied 
-             << setw(12) << available << setw(12) << status << "\n";
-    }
-    printSuccess("Shelters sorted by available capacity");
-}
-
-// 7️⃣ MAX HEAP - Emergency Case Prioritization
-// Time Complexity: O(log n) for insertion, O(1) for peek, O(log n) for extraction
-void addEmergencyCase(EmergencyCase e) {
-    emergencyHeap.push(e);
-    printSuccess("Emergency case added with priority: " + to_string(e.priority));
-}
-
-EmergencyCase getNextEmergency() {
-    if (emergencyHeap.empty()) {
-        return {-1, -1, 0};
-    }
-    EmergencyCase top = emergencyHeap.top();
-    emergencyHeap.pop();
-    return top;
-}
-
-// 8️⃣ RABIN-KARP - Keyword Search in Complaints
-// Time Complexity: O(n + m) average case
-// Space Complexity: O(1)
-bool rabinKarpSearch(const string& text, const string& pattern) {
-    int n = text.length();
-    int m = pattern.length();
-    
-    if (m > n || m == 0) return false;
-    
-    const int d = 256;
-    const int q = 101;
-    
-    int p = 0;
-    int t = 0;
-    int h = 1;
-    
-    for (int i = 0; i < m - 1; i++) {
-        h = (h * d) % q;
-    }
-    
-    for (int i = 0; i < m; i++) {
-        p = (d * p + pattern[i]) % q;
-        t = (d * t + text[i]) % q;
-    }
-    
-    for (int i = 0; i <= n - m; i++) {
-        if (p == t) {
-            bool match = true;
-            for (int j = 0; j < m; j++) {
-                if (text[i + j] != pattern[j]) {
-                    match = false;
-                    break;
-                }
-            }
-            if (match) return true;
-        }
-        
-        if (i < n - m) {
-            t = (d * (t - text[i] * h) + text[i + m]) % q;
-            if (t < 0) t += q;
-        }
-    }
-    
-    return false;
-}
-
-// 🔟 PRIORITY CALCULATION with detailed scoring
-// Time Complexity: O(1)
-int calculatePriority(Homeless& h) {
-    int priority = 0;
-    
-    // Age-based priority
-    if (h.age < 12) priority += 50; // Child
-    else if (h.age > 65) priority += 40; // Elderly
-    else if (h.age > 55) priority += 20; // Senior
-    
-    // Gender-based priority
-    if (h.gender == "Female" || h.gender == "female") priority += 30;
-    
-    // Medical emergency
-    if (h.medicalNeed) priority += 60;
-    
-    // Complaint analysis using Rabin-Karp
-    string complaint = h.complaint;
-    transform(complaint.begin(), complaint.end(), complaint.begin(), ::tolower);
-    
-    if (rabinKarpSearch(complaint, "emergency")) priority += 70;
-    if (rabinKarpSearch(complaint, "critical")) priority += 60;
-    if (rabinKarpSearch(complaint, "medical")) priority += 50;
-    if (rabinKarpSearch(complaint, "child")) priority += 40;
-    if (rabinKarpSearch(complaint, "urgent")) priority += 45;
-    if (rabinKarpSearch(complaint, "danger")) priority += 55;
-    
-    h.priorityScore = priority;
-    return priority;
-}
-
-// SHELTER ALLOCATION SYSTEM using Dijkstra
-void allocateShelter(int homelessID) {
-    printSubHeader("Dijkstra: Shelter Allocation System");
-    
-    Homeless* h = searchHomeless(homelessID);
-    if (!h) {
-        printError("Homeless person with ID " + to_string(homelessID) + " not found");
-        return;
-    }
-    
-    if (h->allocated) {
-        printWarning("Person already allocated to a shelter");
-        for (const Shelter& s : shelters) {
-            if (s.id == h->allocatedShelterID) {
-                cout << "Current Shelter: " << s.name << "\n";
-                break;
-            }
-        }
-        return;
-    }
-    
-    cout << "\nPerson Details:\n";
-    cout << "  Name: " << h->name << "\n";
-    cout << "  Location: Node " << h->locationNodeID << "\n";
-    cout << "  Priority Score: " << h->priorityScore << "\n\n";
-    
-    cout << "Running Dijkstra's algorithm...\n";
-    vector<int> distances = dijkstra(h->locationNodeID);
-    
-    int bestShelter = -1;
-    int minDist = INT_MAX;
-    
-    cout << "\nEvaluating shelters:\n";
-    cout << left << setw(25) << "Shelter" << setw(12) << "Distance" << setw(12) << "Available" << setw(15) << "Status\n";
-    cout << string(64, '-') << "\n";
-    
-    for (const Shelter& s : shelters) {
-        int available = s.capacityTotal - s.capacityOccupied;
-        string status;
-        
-        if (available > 0 && distances[s.nodeID] != INT_MAX) {
-            if (distances[s.nodeID] < minDist) {
-                minDist = distances[s.nodeID];
-                bestShelter = s.id;
-                status = GREEN "SELECTED" RESET;
-            } else {
-                status = "Available";
-            }
-        } else if (available == 0) {
-            status = RED "FULL" RESET;
-        } else {
-            status = RED "UNREACHABLE" RESET;
-        }
-        
-        cout << left << setw(25) << s.name << setw(12) 
-             << (distances[s.nodeID] == INT_MAX ? "∞" : to_string(distances[s.nodeID])) 
-             << setw(12) << available << setw(15) << status << "\n";
-    }
-    
-    if (bestShelter == -1) {
-        printError("No available shelter found!");
-        return;
-    }
-    
-    // Update records
-    for (Shelter& s : shelters) {
-        if (s.id == bestShelter) {
-            s.capacityOccupied++;
-            s.allocatedPersonIDs.push_back(homelessID);
-            h->allocated = true;
-            h->allocatedShelterID = bestShelter;
-            
-            cout << "\n";
-            printSuccess("Allocation Successful!");
-            cout << GREEN << "  → Shelter: " << s.name << "\n";
-            cout << "  → Distance: " << minDist << " units\n";
-            cout << "  → Contact: " << s.contactNumber << RESET << "\n";
-            break;
-        }
-    }
-    
-    // Update in hash table
-    homelessRecords[homelessID] = *h;
-}
-
-// COMPLAINT CLASSIFICATION
-string classifyComplaint(const string& complaint) {
-    string lower = complaint;
-    transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
-    
-    vector<string> categories;
-    
-    if (rabinKarpSearch(lower, "food") || rabinKarpSearch(lower, "hungry") || 
-        rabinKarpSearch(lower, "meal") || rabinKarpSearch(lower, "eat")) {
-        categories.push_back("Food");
-    }
-    
-    if (rabinKarpSearch(lower, "medical") || rabinKarpSearch(lower, "sick") || 
-        rabinKarpSearch(lower, "medicine") || rabinKarpSearch(lower, "health") ||
-        rabinKarpSearch(lower, "doctor")) {
-        categories.push_back("Medical");
-    }
-    
-    if (rabinKarpSearch(lower, "safe") || rabinKarpSearch(lower, "danger") || 
-        rabinKarpSearch(lower, "threat") || rabinKarpSearch(lower, "attack")) {
-        categories.push_back("Safety");
-    }
-    
-    if (rabinKarpSearch(lower, "shelter") || rabinKarpSearch(lower, "bed") || 
-        rabinKarpSearch(lower, "sleep") || rabinKarpSearch(lower, "stay")) {
-        categories.push_back("Shelter");
-    }
-    
-    if (categories.empty()) {
-        return "General";
-    } else if (categories.size() == 1) {
-        return categories[0];
-    } else {
-        string result = categories[0];
-        for (int i = 1; i < categories.size(); i++) {
-            result += ", " + categories[i];
-        }
-        return result;
-    }
-}
-
-// ==================== SUBSYSTEM 1: REGISTRATION & DATA MANAGEMENT ====================
-
-void registrationMenu() {
-    while (true) {
-        clearScreen();
-        printHeader("REGISTRATION & DATA MANAGEMENT SUBSYSTEM");
-        
-        cout << "\n1. Register New Homeless Person\n";
-        cout << "2. Search Person by ID (Binary Search)\n";
-        cout << "3. View All Registered Persons\n";
-        cout << "4. Update Person Information\n";
-        cout << "5. Calculate Priority Score\n";
-        cout << "6. Delete Record\n";
-        cout << "0. Back to Main Menu\n";
-        cout << "\n" << CYAN << "Enter choice: " << RESET;
-        
-        int choice;
-        cin >> choice;
-        cin.ignore();
-        
-        if (choice == 0) break;
-        
-        switch (choice) {
-            case 1: {
-                clearScreen();
-                printSubHeader("Register New Homeless Person");
-                
-                Homeless h;
-                h.id = nextHomelessID++;
-                
-                cout << "Auto-generated ID: " << h.id << "\n\n";
-                cout << "Enter Name: ";
-                getline(cin, h.name);
-                
-                cout << "Enter Age: ";
-                cin >> h.age;
-                cin.ignore();
-                
-                cout << "Enter Gender (Male/Female): ";
-                getline(cin, h.gender);
-                
-                cout << "Enter Location Node ID (0-14): ";
-                cin >> h.locationNodeID;
-                cin.ignore();
-                
-                cout << "Medical Need? (1=Yes, 0=No): ";
-                cin >> h.medicalNeed;
-                cin.ignore();
-                
-                cout << "Enter Complaint/Issue: ";
-                getline(cin, h.complaint);
-                
-                calculatePriority(h);
-                
-                if (addHomelessRecord(h)) {
-                    cout << "\nPriority Score: " << h.priorityScore << "\n";
-                    cout << "Complaint Category: " << classifyComplaint(h.complaint) << "\n";
-                    
-                    if (h.priorityScore > 80) {
-                        printWarning("HIGH PRIORITY CASE - Adding to emergency queue");
-                        addEmergencyCase({h.id, h.priorityScore, time(0)});
-                    }
-                }
-                
-                pressEnterToContinue();
-                break;
-            }
-            
-            case 2: {
-                clearScreen();
-                printSubHeader("Search Person by ID");
-                
-                int id;
-                cout << "Enter ID to search: ";
-                cin >> id;
-                cin.ignore();
-                
-                cout << "\nPerforming Binary Search...\n";
-                int index = binarySearchRecord(id);
-                
-                Homeless* found = searchHomeless(id);
-                if (found) {
-                    cout << "\n" << GREEN << "═══ Person Found ═══" << RESET << "\n";
-                    cout << "ID: " << found->id << "\n";
-                    cout << "Name: " << found->name << "\n";
-                    cout << "Age: " << found->age << "\n";
-                    cout << "Gender: " << found->gender << "\n";
-                    cout << "Location Node: " << found->locationNodeID << "\n";
-                    cout << "Medical Need: " << (found->medicalNeed ? "Yes" : "No") << "\n";
-                    cout << "Priority Score: " << found->priorityScore << "\n";
-                    cout << "Complaint: " << found->complaint << "\n";
-                    cout << "Category: " << classifyComplaint(found->complaint) << "\n";
-                    cout << "Allocated: " << (found->allocated ? "Yes" : "No") << "\n";
-                    if (found->allocated) {
-                        cout << "Shelter ID: " << found->allocatedShelterID << "\n";
-                    }
-                } else {
-                    printError("Person not found");
-                }
-                
-                pressEnterToContinue();
-                break;
-            }
-            
-            case 3: {
-                clearScreen();
-                printSubHeader("All Registered Persons");
-                
-                if (homelessRecords.empty()) {
-                    printWarning("No records found");
-                } else {
-                    cout << left << setw(6) << "ID" << setw(20) << "Name" << setw(6) << "Age" 
-                         << setw(10) << "Gender" << setw(10) << "Priority" << setw(12) << "Allocated\n";
-                    cout << string(64, '-') << "\n";
-                    
-                    for (const auto& pair : homelessRecords) {
-                        const Homeless& h = pair.second;
-                        cout << left << setw(6) << h.id << setw(20) << h.name.substr(0, 18) 
-                             << setw(6) << h.age << setw(10) << h.gender 
-                             << setw(10) << h.priorityScore 
-                             << setw(12) << (h.allocated ? GREEN "Yes" RESET : "No") << "\n";
-                    }
-                    
-                    cout << "\nTotal: " << homelessRecords.size() << " persons\n";
-                }
-                
-                pressEnterToContinue();
-                break;
-            }
-            
-            case 4: {
-                clearScreen();
-                printSubHeader("Update Person Information");
-                
-                int id;
-                cout << "Enter ID: ";
-                cin >> id;
-                cin.ignore();
-                
-                Homeless* h = searchHomeless(id);
-                if (!h) {
-                    printError("Person not found");
-                } else {
-                    cout << "\nCurrent Details:\n";
-                    cout << "Name: " << h->name << "\n";
-                    cout << "Complaint: " << h->complaint << "\n\n";
-                    
-                    cout << "Update Complaint (leave blank to keep current): ";
-                    string newComplaint;
-                    getline(cin, newComplaint);
-                    
-                    if (!newComplaint.empty()) {
-                        h->complaint = newComplaint;
-                        calculatePriority(*h);
-                        homelessRecords[id] = *h;
-                        printSuccess("Record updated. New priority: " + to_string(h->priorityScore));
-                    }
-                }
-                
-                pressEnterToContinue();
-                break;
-            }
-            
-            case 5: {
-                clearScreen();
-                printSubHeader("Recalculate Priority Scores");
-                
-                for (auto& pair : homelessRecords) {
-                    calculatePriority(pair.second);
-                }
-                
-                printSuccess("All priority scores recalculated");
-                pressEnterToContinue();
-                break;
-            }
-            
-            case 6: {
-                clearScreen();
-                printSubHeader("Delete Record");
-                
-                int id;
-                cout << "Enter ID to delete: ";
-                cin >> id;
-                cin.ignore();
-                
-                if (homelessRecords.erase(id)) {
-                    printSuccess("Record deleted");
-                } else {
-                    printError("Record not found");
-                }
-                
-                pressEnterToContinue();
-                break;
-            }
-            
-            default:
-                printError("Invalid choice");
-                pressEnterToContinue();
-        }
-    }
-}
-
-// ==================== SUBSYSTEM 2: SHELTER ALLOCATION & MANAGEMENT ====================
-
-void shelterManagementMenu() {
-    while (true) {
-        clearScreen();
-        printHeader("SHELTER ALLOCATION & MANAGEMENT SUBSYSTEM");
-        
-        cout << "\n1. Allocate Shelter (Dijkstra's Algorithm)\n";
-        cout << "2. View Shelter Status\n";
-        cout << "3. Sort Shelters by Capacity (Merge Sort)\n";
-        cout << "4. Check Shelter Connectivity (DFS)\n";
-        cout << "5. Update Shelter Capacity\n";
-        cout << "6. View Allocated Persons per Shelter\n";
-        cout << "7. Release Person from Shelter\n";
-        cout << "0. Back to Main Menu\n";
-        cout << "\n" << CYAN << "Enter choice: " << RESET;
-        
-        int choice;
-        cin >> choice;
-        cin.ignore();
-        
-        if (choice == 0) break;
-        
-        switch (choice) {
-            case 1: {
-                clearScreen();
-                int id;
-                cout << "Enter Homeless Person ID: ";
-                cin >> id;
-                cin.ignore();
-                allocateShelter(id);
-                pressEnterToContinue();
-                break;
-            }
-            
-            case 2: {
-                clearScreen();
-                printSubHeader("Shelter Status Overview");
-                
-                cout << left << setw(25) << "Shelter Name" << setw(10) << "Node" 
-                     << setw(10) << "Total" << setw(10) << "Occupied" << setw(10) << "Available" 
-                     << setw(15) << "Utilization\n";
-                cout << string(80, '-') << "\n";
-                
-                for (const Shelter& s : shelters) {
-                    int available = s.capacityTotal - s.capacityOccupied;
-                    double util = (s.capacityOccupied * 100.0) / s.capacityTotal;
-                    
-                    cout << left << setw(25) << s.name << setw(10) << s.nodeID 
-                         << setw(10) << s.capacityTotal << setw(10) << s.capacityOccupied 
-                         << setw(10) << available << setw(15) << fixed << setprecision(1) << util << "%\n";
-                }
-                
-                pressEnterToContinue();
-                break;
-            }
-            
-            case 3: {
-                clearScreen();
-                sortSheltersByCapacity();
-                pressEnterToContinue();
-                break;
-            }
-            
-            case 4: {
-                clearScreen();
-                checkShelterConnectivity();
-                pressEnterToContinue();
-                break;
-            }
-            
-            case 5: {
-                clearScreen();
-                printSubHeader("Update Shelter Capacity");
-                
-                int shelterID;
-                cout << "Enter Shelter ID: ";
-                cin >> shelterID;
-                
-                bool found = false;
-                for (Shelter& s : shelters) {
-                    if (s.id == shelterID) {
-                        found = true;
-                        cout << "Current Capacity: " << s.capacityTotal << "\n";
-                        cout << "Enter New Total Capacity: ";
-                        int newCap;
-                        cin >> newCap;
-                        
-                        if (newCap >= s.capacityOccupied) {
-                            s.capacityTotal = newCap;
-                            printSuccess("Capacity updated");
-                        } else {
-                            printError("Cannot set capacity below occupied count");
-                        }
-                        break;
-                    }
-                }
-                
-                if (!found) printError("Shelter not found");
-                
-                cin.ignore();
-                pressEnterToContinue();
-                break;
-            }
-            
-            case 6: {
-                clearScreen();
-                printSubHeader("Allocated Persons per Shelter");
-                
-                for (const Shelter& s : shelters) {
-                    cout << "\n" << BOLD << s.name << RESET << " (Occupied: " 
-                         << s.capacityOccupied << "/" << s.capacityTotal << ")\n";
-                    cout << string(50, '-') << "\n";
-                    
-                    if (s.allocatedPersonIDs.empty()) {
-                        cout << "  No allocations\n";
-                    } else {
-                        for (int pid : s.allocatedPersonIDs) {
-                            Homeless* h = searchHomeless(pid);
-                            if (h) {
-                                cout << "  • " << h->name << " (ID: " << pid << ", Priority: " 
-                                     << h->priorityScore << ")\n";
-                            }
-                        }
-                    }
-                }
-                
-                pressEnterToContinue();
-                break;
-            }
-            
-            case 7: {
-                clearScreen();
-                printSubHeader("Release Person from Shelter");
-                
-                int id;
-                cout << "Enter Homeless Person ID: ";
-                cin >> id;
-                cin.ignore();
-                
-                Homeless* h = searchHomeless(id);
-                if (!h) {
-                    printError("Person not found");
-                } else if (!h->allocated) {
-                    printWarning("Person is not allocated to any shelter");
-                } else {
-                    int shelterID = h->allocatedShelterID;
-                    for (Shelter& s : shelters) {
-                        if (s.id == shelterID) {
-                            s.capacityOccupied--;
-                            auto it = find(s.allocatedPersonIDs.begin(), s.allocatedPersonIDs.end(), id);
-                            if (it != s.allocatedPersonIDs.end()) {
-                                s.allocatedPersonIDs.erase(it);
-                            }
-                            h->allocated = false;
-                            h->allocatedShelterID = -1;
-                            homelessRecords[id] = *h;
-                            printSuccess("Person released from " + s.name);
-                            break;
-                        }
-                    }
-                }
-                
-                pressEnterToContinue();
-                break;
-            }
-            
-            default:
-                printError("Invalid choice");
-                pressEnterToContinue();
-        }
-    }
-}
-
-// ==================== SUBSYSTEM 3: EMERGENCY MANAGEMENT ====================
-
-void emergencyManagementMenu() {
-    while (true) {
-        clearScreen();
-        printHeader("EMERGENCY MANAGEMENT SUBSYSTEM");
-        
-        cout << "\n1. View Emergency Queue\n";
-        cout << "2. Handle Next Emergency (Max Heap)\n";
-        cout << "3. Add Person to Emergency Queue\n";
-        cout << "4. View High Priority Cases\n";
-        cout << "5. Emergency Allocation (Auto)\n";
-        cout << "0. Back to Main Menu\n";
-        cout << "\n" << CYAN << "Enter choice: " << RESET;
-        
-        int choice;
-        cin >> choice;
-        cin.ignore();
-        
-        if (choice == 0) break;
-        
-        switch (choice) {
-            case 1: {
-                clearScreen();
-                printSubHeader("Emergency Queue Status");
-                
-                if (emergencyHeap.empty()) {
-                    printInfo("No pending emergencies");
-                } else {
-                    cout << "Pending Emergencies: " << emergencyHeap.size() << "\n\n";
-                    
-                    // Create temp copy to display without removing
-                    priority_queue<EmergencyCase> tempHeap = emergencyHeap;
-                    int rank = 1;
-                    
-                    cout << left << setw(6) << "Rank" << setw(12) << "Person ID" 
-                         << setw(12) << "Priority" << setw(25) << "Name\n";
-                    cout << string(55, '-') << "\n";
-                    
-                    while (!tempHeap.empty()) {
-                        EmergencyCase ec = tempHeap.top();
-                        tempHeap.pop();
-                        
-                        Homeless* h = searchHomeless(ec.homelessID);
-                        string name = h ? h->name : "Unknown";
-                        
-                        cout << left << setw(6) << rank++ << setw(12) << ec.homelessID 
-                             << setw(12) << ec.priority << setw(25) << name << "\n";
-                    }
-                }
-                
-                pressEnterToContinue();
-                break;
-            }
-            
-            case 2: {
-                clearScreen();
-                printSubHeader("Handle Next Emergency");
-                
-                if (emergencyHeap.empty()) {
-                    printInfo("No pending emergencies");
-                } else {
-                    EmergencyCase ec = getNextEmergency();
-                    
-                    Homeless* h = searchHomeless(ec.homelessID);
-                    if (h) {
-                        cout << RED << "🚨 EMERGENCY CASE 🚨" << RESET << "\n\n";
-                        cout << "Person: " << h->name << "\n";
-                        cout << "Priority: " << ec.priority << "\n";
-                        cout << "Complaint: " << h->complaint << "\n\n";
-                        
-                        if (!h->allocated) {
-                            cout << "Attempting emergency allocation...\n\n";
-                            allocateShelter(ec.homelessID);
-                        } else {
-                            printInfo("Person already allocated to shelter");
-                        }
-                    }
-                }
-                
-                pressEnterToContinue();
-                break;
-            }
-            
-            case 3: {
-                clearScreen();
-                printSubHeader("Add Person to Emergency Queue");
-                
-                int id;
-                cout << "Enter Homeless Person ID: ";
-                cin >> id;
-                cin.ignore();
-                
-                Homeless* h = searchHomeless(id);
-                if (!h) {
-                    printError("Person not found");
-                } else {
-                    calculatePriority(*h);
-                    addEmergencyCase({id, h->priorityScore, time(0)});
-                }
-                
-                pressEnterToContinue();
-                break;
-            }
-            
-            case 4: {
-                clearScreen();
-                printSubHeader("High Priority Cases (Priority > 80)");
-                
-                bool found = false;
-                cout << left << setw(6) << "ID" << setw(20) << "Name" << setw(12) << "Priority" 
-                     << setw(30) << "Complaint\n";
-                cout << string(68, '-') << "\n";
-                
-                for (const auto& pair : homelessRecords) {
-                    const Homeless& h = pair.second;
-                    if (h.priorityScore > 80) {
-                        found = true;
-                        cout << left << setw(6) << h.id << setw(20) << h.name.substr(0, 18) 
-                             << setw(12) << h.priorityScore 
-                             << setw(30) << h.complaint.substr(0, 28) << "\n";
-                    }
-                }
-                
-                if (!found) {
-                    printInfo("No high priority cases");
-                }
-                
-                pressEnterToContinue();
-                break;
-            }
-            
-            case 5: {
-                clearScreen();
-                printSubHeader("Emergency Auto-Allocation");
-                
-                int allocated = 0;
-                while (!emergencyHeap.empty()) {
-                    EmergencyCase ec = getNextEmergency();
-                    Homeless* h = searchHomeless(ec.homelessID);
-                    
-                    if (h && !h->allocated) {
-                        cout << "\nProcessing: " << h->name << " (Priority: " << ec.priority << ")\n";
-                        allocateShelter(ec.homelessID);
-                        allocated++;
-                    }
-                }
-                
-                cout << "\n";
-                printSuccess("Processed " + to_string(allocated) + " emergency cases");
-                pressEnterToContinue();
-                break;
-            }
-            
-            default:
-                printError("Invalid choice");
-                pressEnterToContinue();
-        }
-    }
-}
-
-// ==================== SUBSYSTEM 4: ANALYSIS & REPORTING ====================
-
-void analysisReportingMenu() {
-    while (true) {
-        clearScreen();
-        printHeader("ANALYSIS & REPORTING SUBSYSTEM");
-        
-        cout << "\n1. Generate Daily Report\n";
-        cout << "2. Shelter Utilization Analysis\n";
-        cout << "3. Overcrowding Alert Check\n";
-        cout << "4. Complaint Category Analysis\n";
-        cout << "5. Priority Distribution Report\n";
-        cout << "6. Allocation Efficiency Report\n";
-        cout << "7. Network Analysis Report\n";
-        cout << "0. Back to Main Menu\n";
-        cout << "\n" << CYAN << "Enter choice: " << RESET;
-        
-        int choice;
-        cin >> choice;
-        cin.ignore();
-        
-        if (choice == 0) break;
-        
-        switch (choice) {
-            case 1: {
-                clearScreen();
-                printSubHeader("Daily Summary Report");
-                
-                int totalReg = homelessRecords.size();
-                int totalAllocated = 0;
-                int totalMedical = 0;
-                int totalChildren = 0;
-                
-                for (const auto& pair : homelessRecords) {
-                    if (pair.second.allocated) totalAllocated++;
-                    if (pair.second.medicalNeed) totalMedical++;
-                    if (pair.second.age < 18) totalChildren++;
-                }
-                
-                int totalCap = 0, totalOcc = 0;
-                for (const Shelter& s : shelters) {
-                    totalCap += s.capacityTotal;
-                    totalOcc += s.capacityOccupied;
-                }
-                
-                cout << "╔════════════════════════════════════════╗\n";
-                cout << "║         DAILY OPERATIONS REPORT        ║\n";
-                cout << "╚════════════════════════════════════════╝\n\n";
-                
-                cout << BOLD << "Population Statistics:" << RESET << "\n";
-                cout << "  Total Registered: " << totalReg << "\n";
-                cout << "  Allocated to Shelters: " << totalAllocated << " (" 
-                     << (totalReg > 0 ? (totalAllocated*100)/totalReg : 0) << "%)\n";
-                cout << "  Awaiting Allocation: " << (totalReg - totalAllocated) << "\n";
-                cout << "  Medical Cases: " << totalMedical << "\n";
-                cout << "  Children (<18): " << totalChildren << "\n\n";
-                
-                cout << BOLD << "Shelter Statistics:" << RESET << "\n";
-                cout << "  Total Shelters: " << shelters.size() << "\n";
-                cout << "  Total Capacity: " << totalCap << " beds\n";
-                cout << "  Currently Occupied: " << totalOcc << " beds\n";
-                cout << "  Available: " << (totalCap - totalOcc) << " beds\n";
-                cout << "  Utilization Rate: " << fixed << setprecision(1) 
-                     << (totalCap > 0 ? (totalOcc*100.0)/totalCap : 0) << "%\n\n";
-                
-                cout << BOLD << "Emergency Queue:" << RESET << "\n";
-                cout << "  Pending Cases: " << emergencyHeap.size() << "\n\n";
-                
-                pressEnterToContinue();
-                break;
-            }
-            
-            case 2: {
-                clearScreen();
-                printSubHeader("Shelter Utilization Analysis");
-                
-                cout << left << setw(25) << "Shelter" << setw(15) << "Utilization" 
-                     << setw(15) << "Status" << setw(15) << "Action\n";
-                cout << string(70, '-') << "\n";
-                
-                for (const Shelter& s : shelters) {
-                    double util = (s.capacityOccupied * 100.0) / s.capacityTotal;
-                    string status, action;
-                    
-                    if (util >= 90) {
-                        status = RED "CRITICAL" RESET;
-                        action = "Add capacity";
-                    } else if (util >= 75) {
-                        status = YELLOW "HIGH" RESET;
-                        action = "Monitor";
-                    } else if (util >= 50) {
-                        status = GREEN "NORMAL" RESET;
-                        action = "None";
-                    } else {
-                        status = BLUE "LOW" RESET;
-                        action = "Redirect";
-                    }
-                    
-                    cout << left << setw(25) << s.name << setw(15) << (to_string((int)util) + "%") 
-                         << setw(15) << status << setw(15) << action << "\n";
-                }
-                
-                pressEnterToContinue();
-                break;
-            }
-            
-            case 3: {
-                clearScreen();
-                printSubHeader("Overcrowding Alert System");
-                
-                bool criticalFound = false;
-                for (const Shelter& s : shelters) {
-                    double util = (s.capacityOccupied * 100.0) / s.capacityTotal;
-                    if (util >= 90) {
-                        cout << RED << "🚨 CRITICAL: " << RESET << s.name 
-                             << " is at " << fixed << setprecision(1) << util << "% capacity!\n";
-                        criticalFound = true;
-                    }
-                }
-                
-                if (!criticalFound) {
-                    printSuccess("No overcrowding detected - all shelters within limits");
-                }
-                
-                pressEnterToContinue();
-                break;
-            }
-            
-            case 4: {
-                clearScreen();
-                printSubHeader("Complaint Category Analysis (Rabin-Karp)");
-                
-                unordered_map<string, int> categoryCount;
-                
-                for (const auto& pair : homelessRecords) {
-                    string category = classifyComplaint(pair.second.complaint);
-                    categoryCount[category]++;
-                }
-                
-                cout << left << setw(20) << "Category" << setw(10) << "Count" << setw(15) << "Percentage\n";
-                cout << string(45, '-') << "\n";
-                
-                int total = homelessRecords.size();
-                for (const auto& cat : categoryCount) {
-                    double pct = (cat.second * 100.0) / total;
-                    cout << left << setw(20) << cat.first << setw(10) << cat.second 
-                         << setw(15) << (to_string((int)pct) + "%") << "\n";
-                }
-                
-                pressEnterToContinue();
-                break;
-            }
-            
-            case 5: {
-                clearScreen();
-                printSubHeader("Priority Distribution Report");
-                
-                int low = 0, medium = 0, high = 0, critical = 0;
-                
-                for (const auto& pair : homelessRecords) {
-                    int p = pair.second.priorityScore;
-                    if (p >= 100) critical++;
-                    else if (p >= 70) high++;
-                    else if (p >= 40) medium++;
-                    else low++;
-                }
-                
-                cout << left << setw(20) << "Priority Level" << setw(10) << "Count" << setw(15) << "Percentage\n";
-                cout << string(45, '-') << "\n";
-                
-                int total = homelessRecords.size();
-                cout << left << setw(20) << RED "Critical (100+)" << RESET << setw(10) << critical 
-                     << setw(15) << (total > 0 ? to_string((critical*100)/total) + "%" : "0%") << "\n";
-                cout << left << setw(20) << YELLOW "High (70-99)" << RESET << setw(10) << high 
-                     << setw(15) << (total > 0 ? to_string((high*100)/total) + "%" : "0%") << "\n";
-                cout << left << setw(20) << "Medium (40-69)" << setw(10) << medium 
-                     << setw(15) << (total > 0 ? to_string((medium*100)/total) + "%" : "0%") << "\n";
-                cout << left << setw(20) << "Low (0-39)" << setw(10) << low 
-                     << setw(15) << (total > 0 ? to_string((low*100)/total) + "%" : "0%") << "\n";
-                
-                pressEnterToContinue();
-                break;
-            }
-            
-            case 6: {
-                clearScreen();
-                printSubHeader("Allocation Efficiency Report");
-                
-                int totalReg = homelessRecords.size();
-                int allocated = 0;
-                int highPriorityAllocated = 0;
-                int highPriorityTotal = 0;
-                
-                for (const auto& pair : homelessRecords) {
-                    if (pair.second.allocated) allocated++;
-                    if (pair.second.priorityScore > 80) {
-                        highPriorityTotal++;
-                        if (pair.second.allocated) highPriorityAllocated++;
-                    }
-                }
-                
-                cout << "Overall Allocation Rate: " << (totalReg > 0 ? (allocated*100)/totalReg : 0) << "%\n";
-                cout << "High Priority Allocation: " << (highPriorityTotal > 0 ? (highPriorityAllocated*100)/highPriorityTotal : 0) << "%\n\n";
-                
-                cout << "Efficiency Rating: ";
-                double efficiency = totalReg > 0 ? (allocated*100.0)/totalReg : 0;
-                if (efficiency >= 90) cout << GREEN << "EXCELLENT" << RESET << "\n";
-                else if (efficiency >= 75) cout << GREEN << "GOOD" << RESET << "\n";
-                else if (efficiency >= 50) cout << YELLOW << "AVERAGE" << RESET << "\n";
-                else cout << RED << "NEEDS IMPROVEMENT" << RESET << "\n";
-                
-                pressEnterToContinue();
-                break;
-            }
-            
-            case 7: {
-                clearScreen();
-                printSubHeader("Network Analysis Report");
-                
-                cout << "Graph Statistics:\n";
-                cout << "  Total Nodes: " << nodeCount << "\n";
-                cout << "  Stations: " << stations.size() << "\n";
-                cout << "  Shelters: " << shelters.size() << "\n\n";
-                
-                cout << "Running DFS connectivity check...\n";
-                checkShelterConnectivity();
-                
-                pressEnterToContinue();
-                break;
-            }
-            
-            default:
-                printError("Invalid choice");
-                pressEnterToContinue();
-        }
-    }
-}
-
-// ==================== SUBSYSTEM 5: NETWORK & TRAVERSAL ====================
-
-void networkTraversalMenu() {
-    while (true) {
-        clearScreen();
-        printHeader("NETWORK & TRAVERSAL SUBSYSTEM");
-        
-        cout << "\n1. BFS Traversal from Station\n";
-        cout << "2. DFS Network Connectivity\n";
-        cout << "3. Shortest Path Analysis (Dijkstra)\n";
-        cout << "4. View Network Topology\n";
-        cout << "5. Find Nearest Shelter to Node\n";
-        cout << "0. Back to Main Menu\n";
-        cout << "\n" << CYAN << "Enter choice: " << RESET;
-        
-        int choice;
-        cin >> choice;
-        cin.ignore();
-        
-        if (choice == 0) break;
-        
-        switch (choice) {
-            case 1: {
-                clearScreen();
-                cout << "Available Stations:\n";
-                for (const Station& st : stations) {
-                    cout << "  " << st.name << " (Node " << st.nodeID << ")\n";
-                }
-                
-                int nodeID;
-                cout << "\nEnter Node ID to start BFS: ";
-                cin >> nodeID;
-                cin.ignore();
-                
-                traverseNearbyAreas(nodeID);
-                pressEnterToContinue();
-                break;
-            }
-            
-            case 2: {
-                clearScreen();
-                checkShelterConnectivity();
-                pressEnterToContinue();
-                break;
-            }
-            
-            case 3: {
-                clearScreen();
-                printSubHeader("Shortest Path Analysis");
-                
-                int source;
-                cout << "Enter source node (0-14): ";
-                cin >> source;
-                cin.ignore();
-                
-                if (source < 0 || source >= nodeCount) {
-                    printError("Invalid node");
-                } else {
-                    cout << "\nCalculating shortest paths using Dijkstra...\n\n";
-                    vector<int> dist = dijkstra(source);
-                    
-                    cout << left << setw(15) << "Destination" << setw(15) << "Distance\n";
-                    cout << string(30, '-') << "\n";
-                    
-                    for (const Shelter& s : shelters) {
-                        cout << left << setw(15) << s.name 
-                             << setw(15) << (dist[s.nodeID] == INT_MAX ? "Unreachable" : to_string(dist[s.nodeID])) << "\n";
-                    }
-                }
-                
-                pressEnterToContinue();
-                break;
-            }
-            
-            case 4: {
-                clearScreen();
-                printSubHeader("Network Topology");
-                
-                cout << "Stations:\n";
-                for (const Station& st : stations) {
-                    cout << "  • " << st.name << " at Node " << st.nodeID << "\n";
-                }
-                
-                cout << "\nShelters:\n";
-                for (const Shelter& s : shelters) {
-                    cout << "  • " << s.name << " at Node " << s.nodeID 
-                         << " (Capacity: " << s.capacityOccupied << "/" << s.capacityTotal << ")\n";
-                }
-                
-                cout << "\nTotal Graph Nodes: " << nodeCount << "\n";
-                
-                pressEnterToContinue();
-                break;
-            }
-            
-            case 5: {
-                clearScreen();
-                printSubHeader("Find Nearest Shelter");
-                
-                int nodeID;
-                cout << "Enter node ID: ";
-                cin >> nodeID;
-                cin.ignore();
-                
-                if (nodeID < 0 || nodeID >= nodeCount) {
-                    printError("Invalid node");
-                } else {
-                    vector<int> dist = dijkstra(nodeID);
-                    
-                    int nearest = -1;
-                    int minDist = INT_MAX;
-                    
-                    for (const Shelter& s : shelters) {
-                        if (dist[s.nodeID] < minDist) {
-                            minDist = dist[s.nodeID];
-                            nearest = s.id;
-                        }
-                    }
-                    
-                    if (nearest != -1) {
-                        for (const Shelter& s : shelters) {
-                            if (s.id == nearest) {
-                                cout << "\nNearest Shelter: " << GREEN << s.name << RESET << "\n";
-                                cout << "Distance: " << minDist << " units\n";
-                                cout << "Available Beds: " << (s.capacityTotal - s.capacityOccupied) << "\n";
-                                break;
-                            }
-                        }
-                    }
-                }
-                
-                pressEnterToContinue();
-                break;
-            }
-            
-            default:
-                printError("Invalid choice");
-                pressEnterToContinue();
-        }
-    }
-}
-
-// ==================== INITIALIZATION ====================
-
-void initializeSampleData() {
-    nodeCount = 15;
-    graph.resize(nodeCount);
-    
-    // Build graph
-    graph[0] = {{1, 5}, {2, 10}};
-    graph[1] = {{0, 5}, {3, 7}, {4, 12}};
-    graph[2] = {{0, 10}, {5, 8}};
-    graph[3] = {{1, 7}, {6, 6}};
-    graph[4] = {{1, 12}, {7, 9}};
-    graph[5] = {{2, 8}, {8, 11}};
-    graph[6] = {{3, 6}, {9, 4}};
-    graph[7] = {{4, 9}, {10, 7}};
-    graph[8] = {{5, 11}, {11, 5}};
-    graph[9] = {{6, 4}, {12, 8}};
-    graph[10] = {{7, 7}, {13, 6}};
-    graph[11] = {{8, 5}, {14, 10}};
-    graph[12] = {{9, 8}};
-    graph[13] = {{10, 6}};
-    graph[14] = {{11, 10}};
-    
-    // Stations
-    stations = {
-        {1, "Central Railway Station", 0},
-        {2, "East Junction", 3},
-        {3, "West Terminal", 6}
-    };
-    
-    // Shelters
-    shelters = {
-        {1, "Hope Shelter", 4, 50, 35, "9876543210", {}},
-        {2, "Care Center", 7, 40, 28, "9876543211", {}},
-        {3, "Safe Haven", 10, 60, 45, "9876543212", {}},
-        {4, "Community Home", 13, 30, 15, "9876543213", {}}
-    };
-    
-    // Sample homeless records
-    vector<Homeless> samples = {
-        {101, "Ramesh Kumar", 45, "Male", 0, false, 0, "Need food urgently", time(0), false, -1},
-        {102, "Lakshmi Devi", 65, "Female", 1, true, 0, "Medical help needed", time(0), false, -1},
-        {103, "Anita", 8, "Female", 2, false, 0, "Child alone, scared", time(0), false, -1},
-        {104, "Suresh", 32, "Male", 3, false, 0, "Looking for shelter", time(0), false, -1},
-        {105, "Meera", 70, "Female", 5, true, 0, "Emergency medical case", time(0), false, -1}
-    };
-    
-    for (Homeless& h : samples) {
-        calculatePriority(h);
-        homelessRecords[h.id] = h;
-        homelessList.push_back(h);
-        
-        if (h.priorityScore > 80) {
-            emergencyHeap.push({h.id, h.priorityScore, time(0)});
-        }
-    }
-}
-
-// ==================== MAIN MENU ====================
-
-void displayMainMenu() {
-    clearScreen();
-    printHeader("SMART HOMELESS SHELTER MANAGEMENT SYSTEM");
-    
-    cout << BOLD << "\n┌─────────────────────────────────────────────────────────┐\n";
-    cout << "│                    MAIN MENU - SUBSYSTEMS               │\n";
-    cout << "└─────────────────────────────────────────────────────────┘\n" << RESET;
-    
-    cout << "\n" << CYAN << "1. 📋 Registration & Data Management" << RESET;
-    cout << "\n     » Register, search, update homeless records";
-    cout << "\n     » Uses: Hashing, Binary Search\n";
-    
-    cout << "\n" << GREEN << "2. 🏠 Shelter Allocation & Management" << RESET;
-    cout << "\n     » Allocate shelters, manage capacity";
-    cout << "\n     » Uses: Dijkstra's Algorithm, Merge Sort, DFS\n";
-    
-    cout << "\n" << RED << "3. 🚨 Emergency Management" << RESET;
-    cout << "\n     » Handle emergency cases with priority";
-    cout << "\n     » Uses: Max Heap, Priority Queue\n";
-    
-    cout << "\n" << YELLOW << "4. 📊 Analysis & Reporting" << RESET;
-    cout << "\n     » Generate reports, analyze utilization";
-    cout << "\n     » Uses: Rabin-Karp, Statistical Analysis\n";
-    
-    cout << "\n" << BLUE << "5. 🗺️  Network & Traversal" << RESET;
-    cout << "\n     » BFS/DFS traversal, shortest paths";
-    cout << "\n     » Uses: BFS, DFS, Dijkstra\n";
-    
-    cout << "\n" << MAGENTA << "6. ℹ️  System Information" << RESET;
-    cout << "\n     » View algorithms, complexities, credits\n";
-    
-    cout << "\n0. ❌ Exit System\n";
-    
-    cout << "\n" << BOLD << CYAN << "═══════════════════════════════════════════════════════════\n";
-    cout << "Enter your choice: " << RESET;
-}
-
-void displaySystemInfo() {
-    clearScreen();
-    printHeader("SYSTEM INFORMATION");
-    
-    cout << "\n" << BOLD << "🧠 ALGORITHMS IMPLEMENTED:\n" << RESET;
-    cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n\n";
-    
-    cout << "1.  " << GREEN << "Dijkstra's Algorithm" << RESET << "\n";
-    cout << "    Purpose: Shortest path for shelter allocation\n";
-    cout << "    Complexity: O((V+E) log V)\n\n";
-    
-    cout << "2.  " << GREEN << "Breadth-First Search (BFS)" << RESET << "\n";
-    cout << "    Purpose: Nearby area traversal\n";
-    cout << "    Complexity: O(V + E)\n\n";
-    
-    cout << "3.  " << GREEN << "Depth-First Search (DFS)" << RESET << "\n";
-    cout << "    Purpose: Network connectivity check\n";
-    cout << "    Complexity: O(V + E)\n\n";
-    
-    cout << "4.  " << GREEN << "Hashing" << RESET << "\n";
-    cout << "    Purpose: Fast record storage/retrieval\n";
-    cout << "    Complexity: O(1) average case\n\n";
-    
-    cout << "5.  " << GREEN << "Binary Search" << RESET << "\n";
-    cout << "    Purpose: Efficient ID search\n";
-    cout << "    Complexity: O(log n)\n\n";
-    
-    cout << "6.  " << GREEN << "Merge Sort" << RESET << "\n";
-    cout << "    Purpose: Sort shelters by capacity\n";
-    cout << "    Complexity: O(n log n)\n\n";
-    
-    cout << "7.  " << GREEN << "Max Heap (Priority Queue)" << RESET << "\n";
-    cout << "    Purpose: Emergency prioritization\n";
-    cout << "    Complexity: O(log n) insert/extract\n\n";
-    
-    cout << "8.  " << GREEN << "Rabin-Karp Algorithm" << RESET << "\n";
-    cout << "    Purpose: Pattern matching in complaints\n";
-    cout << "    Complexity: O(n + m) average case\n\n";
-    
-    cout << "\n" << BOLD << "📚 PROJECT DETAILS:\n" << RESET;
-    cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
-    cout << "Title: Smart Homeless Shelter Management System\n";
-    cout << "Domain: Social Welfare + Algorithm Optimization\n";
-    cout << "Language: C++ (STL Only)\n";
-    cout << "Features: 5 Major Subsystems, 17+ Algorithms\n";
-    cout << "Purpose: Academic DAA Project\n";
-    
-    pressEnterToContinue();
-}
-
-int main() {
-    // Initialize system
-    cout << BOLD << CYAN << "\n╔════════════════════════════════════════════════════════╗\n";
-    cout << "║                                                        ║\n";
-    cout << "║     SMART HOMELESS SHELTER MANAGEMENT SYSTEM          ║\n";
-    cout << "║     Design and Analysis of Algorithms Project         ║\n";
-    cout << "║                                                        ║\n";
-    cout << "╚════════════════════════════════════════════════════════╝\n" << RESET;
-    
-    cout << "\n" << YELLOW << "Initializing system..." << RESET << "\n";
-    cout << "  • Loading graph network... ";
-    initializeSampleData();
-    cout << GREEN << "✓" << RESET << "\n";
-    
-    cout << "  • Loading sample data... ";
-    cout << GREEN << "✓" << RESET << "\n";
-    
-    cout << "  • Initializing subsystems... ";
-    cout << GREEN << "✓" << RESET << "\n";
-    
-    cout << "\n" << GREEN << BOLD << "System Ready!" << RESET << "\n";
-    
-    pressEnterToContinue();
-    
-    int choice;
-    do {
-        displayMainMenu();
-        cin >> choice;
-        cin.ignore();
-        
-        switch (choice) {
-            case 1:
-                registrationMenu();
-                break;
-            
-            case 2:
-                shelterManagementMenu();
-                break;
-            
-            case 3:
-                emergencyManagementMenu();
-                break;
-            
-            case 4:
-                analysisReportingMenu();
-                break;
-            
-            case 5:
-                networkTraversalMenu();
-                break;
-            
-            case 6:
-                displaySystemInfo();
-                break;
-            
-            case 0:
-                clearScreen();
-                printHeader("THANK YOU");
-                cout << "\n" << GREEN << "System shutting down gracefully...\n";
-                cout << "All data has been processed.\n";
-                cout << "Goodbye! 👋\n" << RESET << "\n";
-                break;
-            
-            default:
-                printError("Invalid choice! Please try again.");
-                pressEnterToContinue();
-        }
-    } while (choice != 0);
-    
-    return 0;
-}
+#include <iostream>
+#include <vector>
+#include <queue>
+#include <unordered_map>
+#include <algorithm>
+#include <string>
+#include <ctime>
+#include <climits>
+#include <iomanip>
+#include <sstream>
+#include <tuple>
+#include <chrono>
+#include <random>
+#include <fstream>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <future>
+#include <functional>
+#include <memory>
+#include <array>
+#include <cstdio>
+#include <cstring>
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+using namespace std;
+
+// ==================== COLOR CODES FOR CONSOLE ====================
+#define RESET   "\033[0m"
+#define RED     "\033[31m"
+#define GREEN   "\033[32m"
+#define YELLOW  "\033[33m"
+#define BLUE    "\033[34m"
+#define MAGENTA "\033[35m"
+#define CYAN    "\033[36m"
+#define BOLD    "\033[1m"
+
+// ==================== DATA STRUCTURES ====================
+
+struct Homeless {
+    int id;
+    string name;
+    int age;
+    string gender;
+    int locationNodeID;
+    bool medicalNeed;
+    int priorityScore;
+    string complaint;
+    time_t reportedAt;
+    bool allocated;
+    int allocatedShelterID;
+};
+
+struct Shelter {
+    int id;
+    string name;
+    int nodeID;
+    int capacityTotal;
+    int capacityOccupied;
+    string contactNumber;
+    vector<int> allocatedPersonIDs;
+    int capacityHeld = 0;   // beds held for persons still on their way
+};
+
+struct Station {
+    int id;
+    string name;
+    int nodeID;
+};
+
+struct EmergencyCase {
+    int homelessID;
+    int priority;
+    time_t timeReported;
+    
+    bool operator<(const EmergencyCase& other) const {
+        return priority < other.priority; // Max heap
+    }
+};
+
+struct Edge {
+    int dest;
+    int weight;
+};
+
+struct EdgeRange {
+    const Edge* first;
+    const Edge* last;
+    
+    const Edge* begin() const { return first; }
+    const Edge* end() const { return last; }
+};
+
+struct CSRStorage {
+    vector<int> offsets;
+    vector<Edge> edges;
+};
+
+// A view over packed arrays held by `storage`: either a CSRStorage built in
+// memory or a memory-mapped graph file. Copies share the same arrays.
+struct CSRGraph {
+    const int* offsets = nullptr;   // edges of node u are edges[offsets[u] .. offsets[u+1])
+    Edge* edges = nullptr;
+    int nodeCount = 0;
+    int edgeCount = 0;
+    int maxWeight = 0;
+    shared_ptr<void> storage;
+    
+    int nodes() const { return nodeCount; }
+    EdgeRange neighbors(int u) const {
+        return {edges + offsets[u], edges + offsets[u + 1]};
+    }
+};
+
+enum QueueStrategy {
+    QUEUE_AUTO,         // Dial for small weights, radix heap otherwise
+    QUEUE_BINARY_HEAP,
+    QUEUE_DIAL,
+    QUEUE_RADIX_HEAP
+};
+
+struct CatchmentEntry {
+    int shelterID;
+    int distance;
+    int via;      // next node on the way to the shelter, -1 at the shelter itself
+};
+
+struct NodeBitmap {
+    vector<unsigned long long> words;
+    
+    void resize(int n) { words.assign((n + 63) / 64, 0); }
+    bool test(int v) const { return (words[v >> 6] >> (v & 63)) & 1; }
+    void set(int v) { words[v >> 6] |= 1ULL << (v & 63); }
+    int count() const;
+};
+
+struct SweepResult {
+    NodeBitmap reached;
+    vector<int> nodes;        // in visiting order
+    vector<int> levelStart;   // nodes[levelStart[h]..] are h hops away (hop sweeps)
+    int bottomUpLevels;
+};
+
+// Hierarchical timer wheel: LEVELS rings of SLOTS buckets, each ring ticking
+// SLOTS times slower than the one below. Timers are kept in intrusive
+// doubly linked lists (next/prev indexed by timer ID) so cancelling is O(1).
+struct TimerWheel {
+    static const int SLOT_BITS = 6;
+    static const int SLOTS = 1 << SLOT_BITS;
+    static const int LEVELS = 4;        // 64^4 ticks: about 194 days at one tick per second
+    long long now = 0;                  // current tick
+    int pending = 0;
+    int head[LEVELS][SLOTS];
+    vector<long long> due;              // per timer ID; -1 when not scheduled
+    vector<int> next, prev;
+    vector<int> where;                  // level * SLOTS + slot
+};
+
+struct BedHold {
+    int id;
+    int shelterID;
+    int homelessID;
+    time_t expiresAt;
+    bool active;
+};
+
+// Positions in `shelters` never change once assigned, so they serve as handles
+struct ShelterRegistry {
+    unordered_map<int, int> handleOf;   // shelter ID -> position in `shelters`
+    unique_ptr<atomic<int>[]> bedsLeft; // free beds per handle; every bed is claimed here first
+    vector<int> maxFreeBeds;            // segment tree, leaves at [leaves, 2 * leaves)
+    int leaves = 0;
+};
+
+struct ComponentLabels {
+    vector<int> componentOf;     // dense component ID per node
+    vector<int> componentSize;
+};
+
+struct CHEdge {
+    int dest;
+    int weight;
+    int middle;   // contracted node this shortcut bypasses, -1 for a real road
+};
+
+struct ContractionHierarchy {
+    vector<int> rank;
+    vector<int> upOffsets;       // edges u -> w with rank[w] > rank[u]
+    vector<CHEdge> upEdges;
+    vector<int> downOffsets;     // edges w -> u with rank[w] > rank[u], stored at u
+    vector<CHEdge> downEdges;
+    unsigned long long fingerprint;
+};
+
+struct ShortestPathTree {
+    int source;
+    vector<int> dist;
+    vector<int> parent;   // previous node on the path from source, -1 if none
+};
+
+struct RoadUpdateStats {
+    int treeNodesRepaired;
+    int catchmentNodesReranked;
+};
+
+struct NearestShelterResult {
+    vector<CatchmentEntry> shelters;  // ranked by distance
+    int nodesSettled;
+};
+
+const int FLAT_EMPTY_KEY = INT_MIN;
+const int FLAT_MIN_DENSE_GROWTH = 64;
+
+// ID -> handle map without per-entry heap nodes. IDs handed out by
+// nextHomelessID are dense, so any ID inside a growing window starting at
+// the first one seen maps through a plain array; anything else goes to an
+// open-addressing table (linear probing, power-of-two capacity, load <= 0.7).
+struct FlatIDMap {
+    int denseBase = 0;
+    vector<int> dense;                 // ID - denseBase -> handle, -1 if none
+    vector<pair<int, int>> slots;      // (ID, handle); FLAT_EMPTY_KEY when free
+    int slotBits = 0;                  // slots.size() == 1 << slotBits
+    int hashedCount = 0;
+    int count = 0;
+};
+
+const int PERSON_SLAB_BITS = 10;
+const int PERSON_SLAB_SIZE = 1 << PERSON_SLAB_BITS;
+
+// The single copy of every registered person. Records live in fixed-size
+// slabs that are never moved, so a handle (slot number) and any Homeless*
+// taken from it stay valid until that person is deleted. Freed slots are reused.
+struct PersonStore {
+    vector<unique_ptr<Homeless[]>> slabs;
+    vector<unsigned char> live;        // per slot
+    vector<int> freeSlots;
+    FlatIDMap handleOf;                // person ID -> slot
+    int count = 0;
+};
+
+const int ID_INDEX_BATCH = 256;
+
+// Person IDs in ascending order, each paired with its store handle. Inserts
+// that do not land at the end are buffered and merged in batches, so a run of
+// out-of-order registrations costs one merge instead of one shift each.
+struct SortedIDIndex {
+    vector<pair<int, int>> entries;  // (ID, handle), sorted by ID
+    vector<pair<int, int>> pending;  // unsorted, not yet merged
+};
+
+// Struct-of-arrays copy of the person fields that reports aggregate over.
+// Row r of every column is the same person; `handle` leads back to the full
+// record for the string fields, so numeric scans never touch string data.
+struct PersonColumns {
+    vector<int> id;
+    vector<int> age;
+    vector<int> priorityScore;
+    vector<int> locationNodeID;
+    vector<unsigned char> allocated;
+    vector<unsigned char> medicalNeed;
+    vector<int> handle;              // row -> person store handle
+    vector<int> rowOfHandle;         // handle -> row, -1 if none
+};
+
+const int PRIORITY_LEVELS = 512;     // scores above the last level share its bucket
+
+// Secondary indexes over the person store, all holding handles. Each bucket
+// list is unordered; a handle's position in its list is kept so it can be
+// swap-removed in O(1) when the record moves.
+struct PersonIndexes {
+    vector<vector<int>> atNode;          // location node -> handles
+    vector<vector<int>> atPriority;      // priority level -> handles
+    vector<int> priorityTree;            // Fenwick tree of counts per level
+    vector<int> unallocated;             // handles of persons awaiting a bed
+    // Per handle: the node/level it is filed under (-1 if none) and its
+    // position in that bucket and in `unallocated` (-1 if absent)
+    vector<int> node, nodePos;
+    vector<int> level, levelPos;
+    vector<int> unallocatedPos;
+};
+
+const int DUP_BANDS = 8;                          // LSH bands over the name signature
+const int DUP_ROWS = 3;                           // minhashes per band
+const int DUP_NAME_HASHES = DUP_BANDS * DUP_ROWS;
+const int DUP_COMPLAINT_HASHES = 16;
+const int DUP_SIGNATURE = DUP_NAME_HASHES + DUP_COMPLAINT_HASHES;
+
+// 16-bit MinHash signatures of every record's name and complaint, with the
+// name part cut into LSH bands. Entry e = handle * DUP_BANDS + band; the
+// entries of a bucket are chained through nextEntry.
+struct DuplicateIndex {
+    vector<unsigned short> signature;    // DUP_SIGNATURE per handle
+    vector<unsigned int> bandKey;        // per entry
+    vector<int> nextEntry;               // per entry, -1 ends a chain
+    vector<int> bucketHead;              // power-of-two number of buckets
+    vector<char> indexed;                // per handle
+    vector<int> seenBy;                  // per handle: last query that compared it
+    int queries = 0;
+    int count = 0;
+};
+
+struct DuplicateMatch {
+    int handle;
+    double nameSimilarity;               // estimated Jaccard of name shingles
+    double complaintSimilarity;          // estimated Jaccard of complaint shingles
+};
+
+const int POSTING_BLOCK = 128;                    // person IDs per compressed block
+
+// A run of sorted person IDs: the first and last kept as they are, the
+// gaps between neighbours as varints (7 bits per byte, high bit = more)
+struct PostingBlock {
+    int first, last, count;
+    vector<unsigned char> gaps;                   // count - 1 varints
+};
+
+struct PostingList {
+    vector<PostingBlock> blocks;                  // ordered, non-overlapping
+    int size = 0;
+};
+
+// Inverted index over complaint text: word -> posting list of person IDs
+struct ComplaintIndex {
+    unordered_map<string, int> termOf;
+    vector<string> terms;
+    vector<PostingList> postings;                 // per term
+    vector<vector<int>> termsOfHandle;            // sorted terms each record is filed under
+    vector<int> freeTerms;                        // numbers of words no complaint uses any more
+};
+
+// A complaint keyword: priority points it adds and the categories it marks
+// (bit i = categoryNames[i] of the rule set it belongs to)
+struct KeywordRule {
+    string keyword;
+    int weight;
+    int categories;
+};
+
+// The complaint keyword rules in force, from complaint_rules.txt or built in
+struct ComplaintRules {
+    vector<KeywordRule> rules;         // at most 64, one bit each in a match mask
+    vector<string> categoryNames;      // in the order classifications list them
+};
+
+const int KEYWORD_ALPHABET = 27;     // 0 = any non-letter, 1-26 = a-z in either case
+const int KEYWORD_ROW_BITS = 5;      // transition rows padded to 32 entries
+const int KEYWORD_ROW = 1 << KEYWORD_ROW_BITS;
+
+// Aho-Corasick automaton over every complaint keyword. Transitions are a
+// full table over the folded alphabet, so a scan is one lookup per byte.
+struct KeywordMatcher {
+    vector<int> next;                  // row + symbol -> next row (row = state * KEYWORD_ROW)
+    vector<unsigned long long> hits;   // keywords ending at each state (via suffix links too)
+    vector<int> weights;               // per keyword, copied from its rule
+    vector<int> categories;
+    unsigned char symbolOf[256];
+    // Prefilter: keywords by their first two symbols; the distinct lowercase
+    // letters at each of the first three positions, each repeated across a
+    // block for the vector compare; and every distinct three-letter prefix
+    // as indexes into those (-1 third = any byte, for short keywords)
+    vector<string> keywords;
+    unsigned long long startingWith[KEYWORD_ALPHABET][KEYWORD_ALPHABET];
+    int letterCount[3];
+    alignas(32) unsigned char letterVectors[3][26][32];
+    vector<array<int, 3>> prefixes;
+    bool prefixFilter = false;         // every keyword starts with two letters
+    bool built = false;
+};
+
+struct ComplaintMatch {
+    int priority;                      // summed weight of distinct keywords found
+    int categories;                    // OR of their category bits
+};
+
+struct PersonSummary {
+    int total;
+    int allocated;
+    int medical;
+    int children;                    // under 18
+    int highPriority;                // priority > 80
+    int highPriorityAllocated;
+    int priorityBand[4];             // low (0-39), medium (40-69), high (70-99), critical (100+)
+};
+
+struct Report {
+    string date;
+    int totalRegistered;
+    int totalAllocated;
+    int emergenciesHandled;
+    int sheltersAtCapacity;
+};
+
+// ==================== GLOBAL DATA ====================
+
+vector<vector<Edge>> graph;
+CSRGraph roadCSR;
+bool roadCSRValid = false;
+QueueStrategy dijkstraQueue = QUEUE_AUTO;
+ContractionHierarchy roadCH;
+bool roadCHValid = false;
+unordered_map<int, ShortestPathTree> distanceTrees; // cached, keyed by source node
+ComponentLabels roadComponentLabels;
+bool roadComponentsValid = false;
+PersonStore personStore;
+SortedIDIndex personIDIndex;
+PersonColumns personColumns;
+KeywordMatcher complaintMatcher;
+ComplaintRules complaintRules;      // empty until first use, then the defaults or the loaded file
+PersonIndexes personIndexes;
+DuplicateIndex duplicateIndex;
+ComplaintIndex complaintIndex;
+vector<Shelter> shelters;
+ShelterRegistry shelterRegistry;
+bool shelterRegistryValid = false;
+recursive_mutex shelterWrites;      // held while shelter or person records change
+vector<BedHold> bedHolds;           // indexed by hold ID
+TimerWheel holdWheel;
+bool holdWheelStarted = false;
+vector<Station> stations;
+priority_queue<EmergencyCase> emergencyHeap;
+vector<Report> dailyReports;
+int nodeCount = 0;
+int nextHomelessID = 106;
+
+const int CATCHMENT_K = 3;
+vector<vector<CatchmentEntry>> shelterCatchment;
+unordered_map<int, bool> catchmentOpen;
+bool catchmentValid = false;
+
+// Everything the routing and allocation code reads or writes, so a self-test
+// can run on a city of its own and hand the live one back untouched
+struct CityState {
+    vector<vector<Edge>> graph;
+    CSRGraph roadCSR;
+    bool roadCSRValid = false;
+    ContractionHierarchy roadCH;
+    bool roadCHValid = false;
+    unordered_map<int, ShortestPathTree> distanceTrees;
+    ComponentLabels roadComponentLabels;
+    bool roadComponentsValid = false;
+    int nodeCount = 0;
+    PersonStore personStore;
+    SortedIDIndex personIDIndex;
+    PersonColumns personColumns;
+    PersonIndexes personIndexes;
+    DuplicateIndex duplicateIndex;
+    ComplaintIndex complaintIndex;
+    vector<Shelter> shelters;
+    ShelterRegistry shelterRegistry;
+    bool shelterRegistryValid = false;
+    vector<vector<CatchmentEntry>> shelterCatchment;
+    unordered_map<int, bool> catchmentOpen;
+    bool catchmentValid = false;
+    priority_queue<EmergencyCase> emergencyHeap;
+};
+
+void swapCityState(CityState& other) {
+    swap(graph, other.graph);
+    swap(roadCSR, other.roadCSR);
+    swap(roadCSRValid, other.roadCSRValid);
+    swap(roadCH, other.roadCH);
+    swap(roadCHValid, other.roadCHValid);
+    swap(distanceTrees, other.distanceTrees);
+    swap(roadComponentLabels, other.roadComponentLabels);
+    swap(roadComponentsValid, other.roadComponentsValid);
+    swap(nodeCount, other.nodeCount);
+    swap(personStore, other.personStore);
+    swap(personIDIndex, other.personIDIndex);
+    swap(personColumns, other.personColumns);
+    swap(personIndexes, other.personIndexes);
+    swap(duplicateIndex, other.duplicateIndex);
+    swap(complaintIndex, other.complaintIndex);
+    swap(shelters, other.shelters);
+    swap(shelterRegistry, other.shelterRegistry);
+    swap(shelterRegistryValid, other.shelterRegistryValid);
+    swap(shelterCatchment, other.shelterCatchment);
+    swap(catchmentOpen, other.catchmentOpen);
+    swap(catchmentValid, other.catchmentValid);
+    swap(emergencyHeap, other.emergencyHeap);
+}
+
+// ==================== UTILITY FUNCTIONS ====================
+
+void clearScreen() {
+    #ifdef _WIN32
+        system("cls");
+    #else
+        system("clear");
+    #endif
+}
+
+void pressEnterToContinue() {
+    cout << "\n" << CYAN << "Press Enter to continue..." << RESET;
+    cin.ignore();
+    cin.get();
+}
+
+void printHeader(const string& title) {
+    cout << "\n" << BOLD << CYAN;
+    cout << "╔════════════════════════════════════════════════════════════════╗\n";
+    cout << "║" << string(62, ' ') << "║\n";
+    cout << "║";
+    int padding = (62 - title.length()) / 2;
+    cout << string(padding, ' ') << title << string(62 - padding - title.length(), ' ') << "║\n";
+    cout << "║" << string(62, ' ') << "║\n";
+    cout << "╚════════════════════════════════════════════════════════════════╝\n";
+    cout << RESET;
+}
+
+void printSubHeader(const string& title) {
+    cout << "\n" << BOLD << YELLOW << "═══ " << title << " ═══" << RESET << "\n\n";
+}
+
+void printSuccess(const string& msg) {
+    cout << GREEN << "✓ " << msg << RESET << "\n";
+}
+
+void printError(const string& msg) {
+    cout << RED << "✗ " << msg << RESET << "\n";
+}
+
+void printWarning(const string& msg) {
+    cout << YELLOW << "⚠ " << msg << RESET << "\n";
+}
+
+void printInfo(const string& msg) {
+    cout << BLUE << "ℹ " << msg << RESET << "\n";
+}
+
+// Beds that can still be allocated: held beds count as taken
+int freeBeds(const Shelter& s) {
+    return max(0, s.capacityTotal - s.capacityOccupied - s.capacityHeld);
+}
+
+bool hasFreeBeds(const Shelter& s) {
+    return freeBeds(s) > 0;
+}
+
+// ==================== ALGORITHM IMPLEMENTATIONS ====================
+
+// GRAPH STORAGE - Compressed Sparse Row (CSR)
+// The adjacency list `graph` is where roads are added; traversals run on an
+// immutable CSR copy that packs every node's edges into one contiguous array,
+// so scanning a node's roads never leaves the cache line it started on.
+// Time Complexity: O(V + E) to build, O(1) to reach a node's edges
+// Space Complexity: O(V + E)
+CSRGraph viewCSR(const int* offsets, Edge* edges, int nodeCount, shared_ptr<void> storage) {
+    CSRGraph g;
+    g.offsets = offsets;
+    g.edges = edges;
+    g.nodeCount = nodeCount;
+    g.edgeCount = offsets[nodeCount];
+    g.storage = storage;
+    for (int i = 0; i < g.edgeCount; i++) g.maxWeight = max(g.maxWeight, edges[i].weight);
+    return g;
+}
+
+CSRGraph buildCSR(const vector<vector<Edge>>& adj) {
+    shared_ptr<CSRStorage> store = make_shared<CSRStorage>();
+    store->offsets.resize(adj.size() + 1);
+    store->offsets[0] = 0;
+    for (int u = 0; u < adj.size(); u++) {
+        store->offsets[u + 1] = store->offsets[u] + adj[u].size();
+    }
+    
+    store->edges.reserve(store->offsets[adj.size()]);
+    for (const vector<Edge>& roads : adj) {
+        store->edges.insert(store->edges.end(), roads.begin(), roads.end());
+    }
+    return viewCSR(store->offsets.data(), store->edges.data(), adj.size(), store);
+}
+
+// A network loaded from a file arrives as CSR only; the editable adjacency
+// list is copied out of it the first time a road is changed.
+void materializeAdjacency() {
+    if (graph.size() == nodeCount || !roadCSRValid) return;
+    graph.assign(nodeCount, vector<Edge>());
+    for (int u = 0; u < nodeCount; u++) {
+        for (const Edge& e : roadCSR.neighbors(u)) graph[u].push_back(e);
+    }
+}
+
+const CSRGraph& roadNetwork() {
+    if (!roadCSRValid) {
+        roadCSR = buildCSR(graph);
+        roadCSRValid = true;
+    }
+    return roadCSR;
+}
+
+// Synthetic side x side street grid with random two-way weights in [minWeight, maxWeight].
+// Roads are added in random order, the way a loader would, so each node's
+// vector grows and reallocates independently on the heap.
+vector<vector<Edge>> buildGridCity(int side, int minWeight, int maxWeight, mt19937& rng) {
+    vector<pair<int, int>> roads;
+    for (int r = 0; r < side; r++) {
+        for (int c = 0; c < side; c++) {
+            int u = r * side + c;
+            if (c + 1 < side) roads.push_back({u, u + 1});
+            if (r + 1 < side) roads.push_back({u, u + side});
+        }
+    }
+    shuffle(roads.begin(), roads.end(), rng);
+    
+    vector<vector<Edge>> adj(side * side);
+    for (const auto& road : roads) {
+        int w = minWeight + rng() % (maxWeight - minWeight + 1);
+        adj[road.first].push_back({road.second, w});
+        adj[road.second].push_back({road.first, w});
+    }
+    return adj;
+}
+
+// Call after any change to `graph` so derived structures are rebuilt
+void onRoadGraphChanged() {
+    roadCSRValid = false;
+    catchmentValid = false;
+    roadCHValid = false;
+    roadComponentsValid = false;
+    distanceTrees.clear();
+}
+
+// 1️⃣ DIJKSTRA'S ALGORITHM - Shortest Path
+// Time Complexity: O((V+E) log V)
+// Space Complexity: O(V)
+vector<int> dijkstraBinaryHeap(const CSRGraph& g, int source) {
+    int n = g.nodes();
+    vector<int> dist(n, INT_MAX);
+    vector<bool> visited(n, false);
+    priority_queue<pair<int, int>, vector<pair<int, int>>, greater<pair<int, int>>> pq;
+    
+    dist[source] = 0;
+    pq.push({0, source});
+    
+    while (!pq.empty()) {
+        int u = pq.top().second;
+        pq.pop();
+        
+        if (visited[u]) continue;
+        visited[u] = true;
+        
+        for (const Edge& e : g.neighbors(u)) {
+            int v = e.dest;
+            int weight = e.weight;
+            if (dist[u] != INT_MAX && dist[u] + weight < dist[v]) {
+                dist[v] = dist[u] + weight;
+                pq.push({dist[v], v});
+            }
+        }
+    }
+    
+    return dist;
+}
+
+// Same search over the nested adjacency list, kept for layout benchmarks
+vector<int> dijkstraAdjacency(const vector<vector<Edge>>& adj, int source) {
+    int n = adj.size();
+    vector<int> dist(n, INT_MAX);
+    vector<bool> visited(n, false);
+    priority_queue<pair<int, int>, vector<pair<int, int>>, greater<pair<int, int>>> pq;
+    
+    dist[source] = 0;
+    pq.push({0, source});
+    
+    while (!pq.empty()) {
+        int u = pq.top().second;
+        pq.pop();
+        
+        if (visited[u]) continue;
+        visited[u] = true;
+        
+        for (const Edge& e : adj[u]) {
+            if (dist[u] + e.weight < dist[e.dest]) {
+                dist[e.dest] = dist[u] + e.weight;
+                pq.push({dist[e.dest], e.dest});
+            }
+        }
+    }
+    
+    return dist;
+}
+
+// DIAL'S ALGORITHM - Dijkstra with a circular bucket queue
+// Road weights are small integers, so every tentative distance lies within
+// maxWeight of the current one; maxWeight+1 buckets indexed by distance mod
+// (maxWeight+1) replace the heap.
+// Time Complexity: O(V + E + D) where D is the largest distance reached
+// Space Complexity: O(V + C) where C is the largest edge weight
+vector<int> dijkstraDial(const CSRGraph& g, int source) {
+    int n = g.nodes();
+    int width = g.maxWeight + 1;
+    vector<int> dist(n, INT_MAX);
+    vector<bool> visited(n, false);
+    vector<vector<int>> buckets(width);
+    
+    dist[source] = 0;
+    buckets[0].push_back(source);
+    int pending = 1;
+    
+    for (int d = 0; pending > 0; d++) {
+        vector<int>& bucket = buckets[d % width];
+        while (!bucket.empty()) {
+            int u = bucket.back();
+            bucket.pop_back();
+            pending--;
+            
+            if (visited[u] || dist[u] != d) continue;
+            visited[u] = true;
+            
+            for (const Edge& e : g.neighbors(u)) {
+                int nd = d + e.weight;
+                if (nd < dist[e.dest]) {
+                    dist[e.dest] = nd;
+                    buckets[nd % width].push_back(e.dest);
+                    pending++;
+                }
+            }
+        }
+    }
+    
+    return dist;
+}
+
+// RADIX HEAP - monotone priority queue for Dijkstra
+// Keys are grouped by the highest bit in which they differ from the last
+// extracted key; a bucket is redistributed only when it becomes the minimum,
+// and each key can move down at most 32 times.
+// Time Complexity: O(E + V log C)
+// Space Complexity: O(V + E)
+int radixBucket(unsigned x) {
+#if defined(__GNUC__)
+    return x == 0 ? 0 : 32 - __builtin_clz(x);
+#else
+    int b = 0;
+    while (x) { b++; x >>= 1; }
+    return b;
+#endif
+}
+
+struct RadixHeap {
+    vector<pair<unsigned, int>> buckets[33];
+    unsigned last = 0;
+    int size = 0;
+    
+    void push(unsigned key, int node) {
+        buckets[radixBucket(key ^ last)].push_back({key, node});
+        size++;
+    }
+    
+    pair<unsigned, int> pop() {
+        if (buckets[0].empty()) {
+            int i = 1;
+            while (buckets[i].empty()) i++;
+            
+            last = UINT_MAX;
+            for (const auto& item : buckets[i]) last = min(last, item.first);
+            for (const auto& item : buckets[i]) {
+                buckets[radixBucket(item.first ^ last)].push_back(item);
+            }
+            buckets[i].clear();
+        }
+        
+        pair<unsigned, int> top = buckets[0].back();
+        buckets[0].pop_back();
+        size--;
+        return top;
+    }
+};
+
+vector<int> dijkstraRadix(const CSRGraph& g, int source) {
+    int n = g.nodes();
+    vector<int> dist(n, INT_MAX);
+    vector<bool> visited(n, false);
+    RadixHeap heap;
+    
+    dist[source] = 0;
+    heap.push(0, source);
+    
+    while (heap.size > 0) {
+        int u = heap.pop().second;
+        
+        if (visited[u]) continue;
+        visited[u] = true;
+        
+        for (const Edge& e : g.neighbors(u)) {
+            if (dist[u] + e.weight < dist[e.dest]) {
+                dist[e.dest] = dist[u] + e.weight;
+                heap.push(dist[e.dest], e.dest);
+            }
+        }
+    }
+    
+    return dist;
+}
+
+// Bucket queues win while the bucket ring is short enough to sweep cheaply;
+// past this edge weight the radix heap is faster (see network menu option 7).
+const int DIAL_MAX_WEIGHT = 1000;
+
+vector<int> dijkstraCSR(const CSRGraph& g, int source, QueueStrategy strategy) {
+    if (strategy == QUEUE_AUTO) {
+        strategy = g.maxWeight <= DIAL_MAX_WEIGHT ? QUEUE_DIAL : QUEUE_RADIX_HEAP;
+    }
+    
+    switch (strategy) {
+        case QUEUE_DIAL: return dijkstraDial(g, source);
+        case QUEUE_RADIX_HEAP: return dijkstraRadix(g, source);
+        default: return dijkstraBinaryHeap(g, source);
+    }
+}
+
+vector<int> dijkstra(int source) {
+    return dijkstraCSR(roadNetwork(), source, dijkstraQueue);
+}
+
+// 2️⃣ BREADTH-FIRST SEARCH (BFS) - Direction-optimizing outreach sweeps
+// Visited nodes and frontiers are bitmaps. While the frontier is small each
+// frontier node pushes to its neighbours (top-down); once the frontier's
+// roads outnumber a fraction of the unexplored ones, every unvisited node
+// instead checks whether any neighbour is in the frontier (bottom-up, valid
+// because roads are two-way) and stops at the first hit. Bottom-up levels
+// split the bitmap into word-aligned slices, so threads never write the
+// same word.
+// Time Complexity: O(V + E), often far less edge work on dense levels
+// Space Complexity: O(V / 64) for the bitmaps plus the result list
+const int SWEEP_ALPHA = 14;   // switch to bottom-up when frontier edges > unexplored / ALPHA
+const int SWEEP_BETA = 24;    // switch back when frontier nodes < V / BETA
+const int PARALLEL_SWEEP_MIN_NODES = 1 << 16;
+
+int popcount64(unsigned long long x) {
+#if defined(__GNUC__)
+    return __builtin_popcountll(x);
+#else
+    int bits = 0;
+    while (x) { x &= x - 1; bits++; }
+    return bits;
+#endif
+}
+
+int lowestSetBit(unsigned long long x) {
+#if defined(__GNUC__)
+    return __builtin_ctzll(x);
+#else
+    int bit = 0;
+    while (!((x >> bit) & 1)) bit++;
+    return bit;
+#endif
+}
+
+int NodeBitmap::count() const {
+    int total = 0;
+    for (unsigned long long w : words) total += popcount64(w);
+    return total;
+}
+
+// Nodes within maxHops roads of source (maxHops < 0 means no limit), grouped
+// by hop level. threadCount > 1 runs bottom-up levels in parallel.
+SweepResult sweepWithinHops(int source, int maxHops, int threadCount) {
+    const CSRGraph& g = roadNetwork();
+    int n = g.nodes();
+    SweepResult result;
+    result.bottomUpLevels = 0;
+    result.reached.resize(n);
+    if (n < PARALLEL_SWEEP_MIN_NODES) threadCount = 1;
+    threadCount = max(1, threadCount);
+    
+    NodeBitmap frontierBits, nextBits;
+    frontierBits.resize(n);
+    nextBits.resize(n);
+    
+    vector<int> frontier = {source};
+    result.reached.set(source);
+    result.nodes.push_back(source);
+    result.levelStart = {0};
+    
+    long long unexploredEdges = g.edgeCount - (g.offsets[source + 1] - g.offsets[source]);
+    bool bottomUp = false;
+    
+    for (int hop = 1; !frontier.empty() && (maxHops < 0 || hop <= maxHops); hop++) {
+        long long frontierEdges = 0;
+        for (int u : frontier) frontierEdges += g.offsets[u + 1] - g.offsets[u];
+        
+        if (!bottomUp && frontierEdges > unexploredEdges / SWEEP_ALPHA) bottomUp = true;
+        else if (bottomUp && frontier.size() < n / SWEEP_BETA) bottomUp = false;
+        
+        result.levelStart.push_back(result.nodes.size());
+        vector<int> next;
+        
+        if (!bottomUp) {
+            for (int u : frontier) {
+                for (const Edge& e : g.neighbors(u)) {
+                    if (!result.reached.test(e.dest)) {
+                        result.reached.set(e.dest);
+                        next.push_back(e.dest);
+                    }
+                }
+            }
+        } else {
+            result.bottomUpLevels++;
+            fill(frontierBits.words.begin(), frontierBits.words.end(), 0);
+            fill(nextBits.words.begin(), nextBits.words.end(), 0);
+            for (int u : frontier) frontierBits.set(u);
+            
+            int wordCount = result.reached.words.size();
+            int chunk = (wordCount + threadCount - 1) / threadCount;
+            vector<vector<int>> found(threadCount);
+            
+            auto scan = [&](int t) {
+                int lo = min(wordCount, t * chunk), hi = min(wordCount, lo + chunk);
+                for (int w = lo; w < hi; w++) {
+                    unsigned long long unvisited = ~result.reached.words[w];
+                    while (unvisited) {
+                        int bit = lowestSetBit(unvisited);
+                        unvisited &= unvisited - 1;
+                        
+                        int v = w * 64 + bit;
+                        if (v >= n) break;
+                        for (const Edge& e : g.neighbors(v)) {
+                            if (frontierBits.test(e.dest)) {
+                                nextBits.words[w] |= 1ULL << bit;
+                                found[t].push_back(v);
+                                break;
+                            }
+                        }
+                    }
+                }
+            };
+            
+            vector<thread> workers;
+            for (int t = 1; t < threadCount; t++) workers.emplace_back(scan, t);
+            scan(0);
+            for (thread& worker : workers) worker.join();
+            
+            for (int w = 0; w < wordCount; w++) result.reached.words[w] |= nextBits.words[w];
+            for (const vector<int>& part : found) next.insert(next.end(), part.begin(), part.end());
+        }
+        
+        for (int v : next) unexploredEdges -= g.offsets[v + 1] - g.offsets[v];
+        result.nodes.insert(result.nodes.end(), next.begin(), next.end());
+        frontier.swap(next);
+    }
+    
+    if (result.levelStart.back() == result.nodes.size()) result.levelStart.pop_back();
+    return result;
+}
+
+// Nodes within `radius` road distance of source, nearest first. A bounded
+// Dijkstra over a hash map, so a short radius stays local on a big city.
+SweepResult sweepWithinDistance(int source, int radius) {
+    const CSRGraph& g = roadNetwork();
+    SweepResult result;
+    result.bottomUpLevels = 0;
+    result.reached.resize(g.nodes());
+    result.levelStart = {0};
+    
+    unordered_map<int, int> dist;
+    priority_queue<pair<int, int>, vector<pair<int, int>>, greater<pair<int, int>>> pq;
+    dist[source] = 0;
+    pq.push({0, source});
+    
+    while (!pq.empty()) {
+        int d = pq.top().first;
+        int u = pq.top().second;
+        pq.pop();
+        if (result.reached.test(u)) continue;
+        result.reached.set(u);
+        result.nodes.push_back(u);
+        
+        for (const Edge& e : g.neighbors(u)) {
+            int nd = d + e.weight;
+            if (nd > radius) continue;
+            auto it = dist.find(e.dest);
+            if (it == dist.end() || nd < it->second) {
+                dist[e.dest] = nd;
+                pq.push({nd, e.dest});
+            }
+        }
+    }
+    
+    return result;
+}
+
+void traverseNearbyAreas(int stationNodeID, int maxHops) {
+    printSubHeader("BFS: Nearby Area Traversal");
+    
+    if (stationNodeID < 0 || stationNodeID >= nodeCount) {
+        printError("Invalid node ID!");
+        return;
+    }
+    
+    SweepResult sweep = sweepWithinHops(stationNodeID, maxHops, thread::hardware_concurrency());
+    
+    cout << "Starting Node: " << stationNodeID << "\n";
+    for (int level = 0; level < sweep.levelStart.size(); level++) {
+        int begin = sweep.levelStart[level];
+        int end = level + 1 < sweep.levelStart.size() ? sweep.levelStart[level + 1] : sweep.nodes.size();
+        cout << "  Hop " << level << ": ";
+        for (int i = begin; i < end; i++) {
+            cout << sweep.nodes[i] << (i + 1 < end ? ", " : "");
+        }
+        cout << "\n";
+    }
+    cout << "Nodes reached: " << sweep.reached.count() << " (" << sweep.bottomUpLevels << " bottom-up levels)\n";
+    printSuccess("BFS traversal completed");
+}
+
+// 3️⃣ DEPTH-FIRST SEARCH (DFS)
+// An explicit stack of (node, next edge) frames visits nodes in the same
+// order as the recursive version without risking a stack overflow on long
+// chains of road segments.
+// Time Complexity: O(V + E)
+// Space Complexity: O(V)
+void dfsIterative(const CSRGraph& g, int start, vector<bool>& visited, vector<int>& dfsOrder) {
+    vector<pair<int, int>> stack;
+    visited[start] = true;
+    dfsOrder.push_back(start);
+    stack.push_back({start, g.offsets[start]});
+    
+    while (!stack.empty()) {
+        int node = stack.back().first;
+        int& next = stack.back().second;
+        
+        if (next == g.offsets[node + 1]) {
+            stack.pop_back();
+            continue;
+        }
+        
+        int dest = g.edges[next++].dest;
+        if (!visited[dest]) {
+            visited[dest] = true;
+            dfsOrder.push_back(dest);
+            stack.push_back({dest, g.offsets[dest]});
+        }
+    }
+}
+
+// CONNECTED COMPONENTS - Concurrent Union-Find
+// Each thread unions the roads of its own slice of nodes. Roots are always
+// linked from the larger index to the smaller one with a compare-and-swap,
+// so parent pointers only ever decrease and no cycle can form; finds halve
+// paths the same way. Roads are two-way, so these are the reachability
+// classes and "can Y reach X" is a comparison of two labels.
+// Time Complexity: O((V + E) α(V) / threads)
+// Space Complexity: O(V)
+const int PARALLEL_COMPONENT_MIN_EDGES = 1 << 16;
+
+int concurrentFind(vector<atomic<int>>& parent, int x) {
+    while (true) {
+        int p = parent[x].load(memory_order_relaxed);
+        if (p == x) return x;
+        int grandparent = parent[p].load(memory_order_relaxed);
+        if (p != grandparent) {
+            parent[x].compare_exchange_weak(p, grandparent, memory_order_relaxed);
+        }
+        x = grandparent;
+    }
+}
+
+void concurrentUnion(vector<atomic<int>>& parent, int a, int b) {
+    while (true) {
+        a = concurrentFind(parent, a);
+        b = concurrentFind(parent, b);
+        if (a == b) return;
+        if (a < b) swap(a, b);
+        
+        int expected = a;
+        if (parent[a].compare_exchange_strong(expected, b, memory_order_relaxed)) return;
+    }
+}
+
+ComponentLabels labelComponents(const CSRGraph& g, int threadCount) {
+    int n = g.nodes();
+    vector<atomic<int>> parent(n);
+    for (int v = 0; v < n; v++) parent[v].store(v, memory_order_relaxed);
+    
+    if (g.edgeCount < PARALLEL_COMPONENT_MIN_EDGES) threadCount = 1;
+    threadCount = max(1, threadCount);
+    
+    auto runSlices = [&](const function<void(int, int)>& work) {
+        vector<thread> workers;
+        int chunk = (n + threadCount - 1) / threadCount;
+        for (int t = 1; t < threadCount; t++) {
+            int lo = min(n, t * chunk), hi = min(n, lo + chunk);
+            workers.emplace_back(work, lo, hi);
+        }
+        work(0, min(n, chunk));
+        for (thread& worker : workers) worker.join();
+    };
+    
+    runSlices([&](int lo, int hi) {
+        for (int u = lo; u < hi; u++) {
+            for (const Edge& e : g.neighbors(u)) {
+                if (u < e.dest) concurrentUnion(parent, u, e.dest);
+            }
+        }
+    });
+    
+    ComponentLabels labels;
+    labels.componentOf.resize(n);
+    runSlices([&](int lo, int hi) {
+        for (int v = lo; v < hi; v++) labels.componentOf[v] = concurrentFind(parent, v);
+    });
+    
+    // Renumber roots densely; every root is the smallest node of its component
+    vector<int> dense(n, -1);
+    for (int v = 0; v < n; v++) {
+        int root = labels.componentOf[v];
+        if (dense[root] == -1) {
+            dense[root] = labels.componentSize.size();
+            labels.componentSize.push_back(0);
+        }
+        labels.componentOf[v] = dense[root];
+        labels.componentSize[dense[root]]++;
+    }
+    
+    return labels;
+}
+
+const ComponentLabels& roadComponents() {
+    if (!roadComponentsValid) {
+        roadComponentLabels = labelComponents(roadNetwork(), thread::hardware_concurrency());
+        roadComponentsValid = true;
+    }
+    return roadComponentLabels;
+}
+
+bool isReachable(int from, int to) {
+    const ComponentLabels& labels = roadComponents();
+    return labels.componentOf[from] == labels.componentOf[to];
+}
+
+bool checkShelterConnectivity() {
+    printSubHeader("Union-Find: Shelter Network Connectivity Check");
+    
+    if (shelters.empty()) {
+        printWarning("No shelters registered in the system");
+        return true;
+    }
+    
+    vector<bool> visited(nodeCount, false);
+    vector<int> dfsOrder;
+    dfsIterative(roadNetwork(), shelters[0].nodeID, visited, dfsOrder);
+    
+    // Only the start of the walk: a city network has far too many nodes to list
+    const int shown = 20;
+    cout << "DFS Traversal from Shelter '" << shelters[0].name << "' (" << dfsOrder.size() << " nodes):\n";
+    for (int i = 0; i < dfsOrder.size() && i < shown; i++) {
+        cout << dfsOrder[i];
+        if (i < dfsOrder.size() - 1) cout << " → ";
+    }
+    if (dfsOrder.size() > shown) cout << "...";
+    cout << "\n\n";
+    
+    const ComponentLabels& labels = roadComponents();
+    
+    bool allConnected = true;
+    cout << left << setw(25) << "Shelter Name" << setw(15) << "Node ID" << setw(12) << "Component" << setw(15) << "Status\n";
+    cout << string(67, '-') << "\n";
+    
+    vector<bool> hasShelter(labels.componentSize.size(), false);
+    for (const Shelter& s : shelters) {
+        int component = labels.componentOf[s.nodeID];
+        hasShelter[component] = true;
+        
+        bool connected = isReachable(shelters[0].nodeID, s.nodeID);
+        string status = connected ? GREEN "Connected" RESET : RED "UNREACHABLE" RESET;
+        cout << left << setw(25) << s.name << setw(15) << s.nodeID << setw(12) << component << setw(15) << status << "\n";
+        if (!connected) allConnected = false;
+    }
+    
+    if (allConnected) {
+        printSuccess("All shelters are connected in the network");
+    } else {
+        printError("Some shelters are unreachable - network has issues!");
+    }
+    
+    // Every component without a shelter, found in the same labelling pass
+    vector<vector<int>> isolated(labels.componentSize.size());
+    for (int v = 0; v < nodeCount; v++) {
+        int component = labels.componentOf[v];
+        if (!hasShelter[component] && isolated[component].size() < 5) isolated[component].push_back(v);
+    }
+    
+    cout << "\nRoad network components: " << labels.componentSize.size() << "\n";
+    bool anyIsolated = false;
+    for (int c = 0; c < labels.componentSize.size(); c++) {
+        if (hasShelter[c]) continue;
+        anyIsolated = true;
+        cout << RED << "  Component " << c << RESET << ": " << labels.componentSize[c] 
+             << " nodes with no shelter (e.g. nodes";
+        for (int v : isolated[c]) cout << " " << v;
+        cout << ")\n";
+    }
+    if (!anyIsolated) {
+        printSuccess("Every node can reach at least one shelter");
+    }
+    
+    return allConnected;
+}
+
+// FLAT ID MAP - Dense array window + open addressing
+// Time Complexity: O(1) for IDs in the dense window, O(1) expected otherwise
+// Space Complexity: 4 bytes per dense ID, 8 / 0.7 bytes per hashed ID
+int flatHome(const FlatIDMap& m, int id) {
+    return ((unsigned)id * 2654435769u) >> (32 - m.slotBits);
+}
+
+bool inDenseWindow(const FlatIDMap& m, int id) {
+    return id >= m.denseBase && (long long)id - m.denseBase < m.dense.size();
+}
+
+// Handle for id, or -1
+int flatFind(const FlatIDMap& m, int id) {
+    if (inDenseWindow(m, id)) return m.dense[id - m.denseBase];
+    if (m.hashedCount == 0) return -1;
+    
+    int mask = m.slots.size() - 1;
+    for (int i = flatHome(m, id); ; i = (i + 1) & mask) {
+        if (m.slots[i].first == id) return m.slots[i].second;
+        if (m.slots[i].first == FLAT_EMPTY_KEY) return -1;
+    }
+}
+
+// Places `entries` into a fresh table of 1 << slotBits slots
+void flatRebuild(FlatIDMap& m, int slotBits, const vector<pair<int, int>>& entries) {
+    m.slotBits = slotBits;
+    m.slots.assign(1 << slotBits, {FLAT_EMPTY_KEY, -1});
+    m.hashedCount = 0;
+    int mask = m.slots.size() - 1;
+    for (const auto& entry : entries) {
+        if (entry.first == FLAT_EMPTY_KEY) continue;
+        int i = flatHome(m, entry.first);
+        while (m.slots[i].first != FLAT_EMPTY_KEY) i = (i + 1) & mask;
+        m.slots[i] = entry;
+        m.hashedCount++;
+    }
+}
+
+// Widens the dense window to `size` IDs, moving in any hashed IDs it now covers
+void growDenseWindow(FlatIDMap& m, size_t size) {
+    m.dense.resize(size, -1);
+    if (m.hashedCount == 0) return;
+    
+    vector<pair<int, int>> kept;
+    for (const auto& slot : m.slots) {
+        if (slot.first == FLAT_EMPTY_KEY) continue;
+        if (inDenseWindow(m, slot.first)) {
+            m.dense[slot.first - m.denseBase] = slot.second;
+        } else {
+            kept.push_back(slot);
+        }
+    }
+    if (kept.size() < m.hashedCount) flatRebuild(m, m.slotBits, kept);
+}
+
+// Value slot for id, created as -1 if the ID is new. The pointer is valid
+// until the next insert.
+int* flatSlot(FlatIDMap& m, int id) {
+    if (m.count == 0 && m.dense.empty()) m.denseBase = id;
+    
+    // Dense path: in the window, or close enough past its end to grow it
+    if (id >= m.denseBase) {
+        long long offset = (long long)id - m.denseBase;
+        if (offset >= m.dense.size() && offset < 2 * (long long)m.dense.size() + FLAT_MIN_DENSE_GROWTH) {
+            growDenseWindow(m, max({2 * m.dense.size(), (size_t)offset + 1, (size_t)FLAT_MIN_DENSE_GROWTH}));
+        }
+        if (offset < m.dense.size()) {
+            if (m.dense[offset] < 0) m.count++;
+            return &m.dense[offset];
+        }
+    }
+    
+    if (m.slots.empty()) flatRebuild(m, 4, {});
+    int mask = m.slots.size() - 1;
+    int i = flatHome(m, id);
+    while (m.slots[i].first != FLAT_EMPTY_KEY) {
+        if (m.slots[i].first == id) return &m.slots[i].second;
+        i = (i + 1) & mask;
+    }
+    
+    if ((m.hashedCount + 1) * 10 > (int)m.slots.size() * 7) {
+        vector<pair<int, int>> old;
+        old.swap(m.slots);
+        flatRebuild(m, m.slotBits + 1, old);
+        return flatSlot(m, id);
+    }
+    m.slots[i] = {id, -1};
+    m.hashedCount++;
+    m.count++;
+    return &m.slots[i].second;
+}
+
+bool flatErase(FlatIDMap& m, int id) {
+    if (inDenseWindow(m, id)) {
+        int& handle = m.dense[id - m.denseBase];
+        if (handle < 0) return false;
+        handle = -1;
+        m.count--;
+        return true;
+    }
+    if (m.hashedCount == 0) return false;
+    
+    int mask = m.slots.size() - 1;
+    int i = flatHome(m, id);
+    while (m.slots[i].first != id) {
+        if (m.slots[i].first == FLAT_EMPTY_KEY) return false;
+        i = (i + 1) & mask;
+    }
+    
+    // Backward-shift deletion: pull later entries of the probe run into the
+    // hole so lookups never need tombstones
+    for (int j = (i + 1) & mask; m.slots[j].first != FLAT_EMPTY_KEY; j = (j + 1) & mask) {
+        int home = flatHome(m, m.slots[j].first);
+        if (((j - home) & mask) >= ((j - i) & mask)) {
+            m.slots[i] = m.slots[j];
+            i = j;
+        }
+    }
+    m.slots[i] = {FLAT_EMPTY_KEY, -1};
+    m.hashedCount--;
+    m.count--;
+    return true;
+}
+
+size_t flatMemoryBytes(const FlatIDMap& m) {
+    return m.dense.capacity() * sizeof(int) + m.slots.capacity() * sizeof(pair<int, int>);
+}
+
+// Allocator that tallies live bytes, so the benchmark can report what a
+// node-based map really costs per entry
+size_t countedBytes = 0;
+
+template <class T>
+struct CountingAllocator {
+    using value_type = T;
+    CountingAllocator() = default;
+    template <class U> CountingAllocator(const CountingAllocator<U>&) {}
+    T* allocate(size_t n) {
+        countedBytes += n * sizeof(T);
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+    void deallocate(T* p, size_t n) {
+        countedBytes -= n * sizeof(T);
+        ::operator delete(p);
+    }
+    template <class U> bool operator==(const CountingAllocator<U>&) const { return true; }
+    template <class U> bool operator!=(const CountingAllocator<U>&) const { return false; }
+};
+
+// Insert and lookup throughput of unordered_map<int, int> vs FlatIDMap for
+// `count` sequential IDs (as nextHomelessID hands out) and scattered IDs
+void benchmarkRecordTable(int count) {
+    printSubHeader("Record Table Benchmark: unordered_map vs Flat ID Map");
+    
+    mt19937 rng(11);
+    vector<int> sequential(count), scattered(count);
+    for (int i = 0; i < count; i++) sequential[i] = 101 + i;
+    unordered_map<int, bool> seen;
+    for (int i = 0; i < count; ) {
+        int id = rng() & 0x7fffffff;
+        if (seen.emplace(id, true).second) scattered[i++] = id;
+    }
+    seen.clear();
+    
+    cout << "Records: " << count << "  (insert all, then look each up in random order)\n\n";
+    cout << left << setw(12) << "IDs" << setw(22) << "Table" << setw(16) << "Insert (M/s)" 
+         << setw(16) << "Lookup (M/s)" << setw(14) << "Bytes/record" << "\n";
+    cout << string(80, '-') << "\n";
+    
+    for (int pass = 0; pass < 2; pass++) {
+        const vector<int>& ids = pass == 0 ? sequential : scattered;
+        vector<int> probes = ids;
+        shuffle(probes.begin(), probes.end(), rng);
+        long long checksum[2] = {0, 0};
+        
+        for (int variant = 0; variant < 2; variant++) {
+            double insertMs, lookupMs;
+            size_t bytes;
+            if (variant == 0) {
+                countedBytes = 0;
+                unordered_map<int, int, hash<int>, equal_to<int>, CountingAllocator<pair<const int, int>>> table;
+                auto start = chrono::steady_clock::now();
+                for (int i = 0; i < count; i++) table.emplace(ids[i], i);
+                insertMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+                start = chrono::steady_clock::now();
+                for (int id : probes) {
+                    auto it = table.find(id);
+                    checksum[variant] += it == table.end() ? -1 : it->second;
+                }
+                lookupMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+                bytes = countedBytes;
+            } else {
+                FlatIDMap table;
+                auto start = chrono::steady_clock::now();
+                for (int i = 0; i < count; i++) *flatSlot(table, ids[i]) = i;
+                insertMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+                start = chrono::steady_clock::now();
+                for (int id : probes) checksum[variant] += flatFind(table, id);
+                lookupMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+                bytes = flatMemoryBytes(table);
+            }
+            
+            cout << left << setw(12) << (pass == 0 ? "Sequential" : "Scattered") 
+                 << setw(22) << (variant == 0 ? "unordered_map" : "FlatIDMap") << fixed << setprecision(1) 
+                 << setw(16) << count / insertMs / 1000 << setw(16) << count / lookupMs / 1000 
+                 << setw(14) << (double)bytes / count << "\n";
+        }
+        
+        if (checksum[0] != checksum[1]) {
+            printError("Lookup results differ!");
+        }
+    }
+    
+    cout << "\nThe old record table, unordered_map<int, Homeless>, also stored each record inside its node\n";
+    cout << "(" << sizeof(Homeless) << " bytes); the store now keeps records in its slabs and maps only ID -> handle.\n";
+}
+
+// PERSON STORE - Slab arena addressed by stable handles
+// Time Complexity: O(1) per access, O(1) average per insert/erase/ID lookup
+// Space Complexity: O(n)
+Homeless& personAt(int handle) {
+    return personStore.slabs[handle >> PERSON_SLAB_BITS][handle & (PERSON_SLAB_SIZE - 1)];
+}
+
+int personHandle(int id) {
+    return flatFind(personStore.handleOf, id);
+}
+
+int personCount() {
+    return personStore.count;
+}
+
+// Calls f(Homeless&) for every live record, in slot order
+template <class F>
+void forEachPerson(F f) {
+    for (int handle = 0; handle < personStore.live.size(); handle++) {
+        if (personStore.live[handle]) f(personAt(handle));
+    }
+}
+
+// SORTED ID INDEX - Flat sorted vector with batched inserts
+// Time Complexity: O(1) for in-order inserts, O(n + b log b) per merge of b
+//                  buffered ones, O(log n) lookup, O(log n + k) range/page
+// Space Complexity: O(n)
+void flushIDIndex(SortedIDIndex& index) {
+    if (index.pending.empty()) return;
+    
+    sort(index.pending.begin(), index.pending.end());
+    int oldSize = index.entries.size();
+    index.entries.insert(index.entries.end(), index.pending.begin(), index.pending.end());
+    if (oldSize > 0 && index.entries[oldSize - 1].first > index.pending.front().first) {
+        inplace_merge(index.entries.begin(), index.entries.begin() + oldSize, index.entries.end());
+    }
+    index.pending.clear();
+}
+
+void idIndexInsert(SortedIDIndex& index, int id, int handle) {
+    if (index.pending.empty() && (index.entries.empty() || index.entries.back().first < id)) {
+        index.entries.push_back({id, handle});
+        return;
+    }
+    index.pending.push_back({id, handle});
+    if (index.pending.size() >= ID_INDEX_BATCH) flushIDIndex(index);
+}
+
+void idIndexErase(SortedIDIndex& index, int id) {
+    for (int i = 0; i < index.pending.size(); i++) {
+        if (index.pending[i].first == id) {
+            index.pending[i] = index.pending.back();
+            index.pending.pop_back();
+            return;
+        }
+    }
+    auto it = lower_bound(index.entries.begin(), index.entries.end(), make_pair(id, INT_MIN));
+    if (it != index.entries.end() && it->first == id) index.entries.erase(it);
+}
+
+// All (ID, handle) entries in ID order
+const vector<pair<int, int>>& sortedPersonIDs() {
+    flushIDIndex(personIDIndex);
+    return personIDIndex.entries;
+}
+
+// Handles of persons with lo <= ID <= hi, in ID order
+vector<int> personsInIDRange(int lo, int hi) {
+    const vector<pair<int, int>>& entries = sortedPersonIDs();
+    vector<int> handles;
+    auto it = lower_bound(entries.begin(), entries.end(), make_pair(lo, INT_MIN));
+    for (; it != entries.end() && it->first <= hi; ++it) {
+        handles.push_back(it->second);
+    }
+    return handles;
+}
+
+// Handles of up to `count` persons whose ID is greater than afterID, in ID
+// order - one page of a listing; pass the last ID shown to get the next page
+vector<int> personsAfterID(int afterID, int count) {
+    const vector<pair<int, int>>& entries = sortedPersonIDs();
+    vector<int> handles;
+    auto it = upper_bound(entries.begin(), entries.end(), make_pair(afterID, INT_MAX));
+    for (; it != entries.end() && handles.size() < count; ++it) {
+        handles.push_back(it->second);
+    }
+    return handles;
+}
+
+// Copies h into a free slot and returns its handle, or -1 if the ID is taken
+int insertPerson(const Homeless& h) {
+    PersonStore& ps = personStore;
+    int* slot = flatSlot(ps.handleOf, h.id);
+    if (*slot >= 0) return -1;
+    
+    int handle;
+    if (!ps.freeSlots.empty()) {
+        handle = ps.freeSlots.back();
+        ps.freeSlots.pop_back();
+    } else {
+        handle = ps.live.size();
+        if ((handle & (PERSON_SLAB_SIZE - 1)) == 0) ps.slabs.emplace_back(new Homeless[PERSON_SLAB_SIZE]);
+        ps.live.push_back(0);
+    }
+    
+    personAt(handle) = h;
+    ps.live[handle] = 1;
+    ps.count++;
+    *slot = handle;
+    idIndexInsert(personIDIndex, h.id, handle);
+    return handle;
+}
+
+// Empties the slot (dropping its strings) and puts it on the free list
+void releasePersonSlot(int handle) {
+    PersonStore& ps = personStore;
+    Homeless& h = personAt(handle);
+    flatErase(ps.handleOf, h.id);
+    idIndexErase(personIDIndex, h.id);
+    h = Homeless();
+    ps.live[handle] = 0;
+    ps.freeSlots.push_back(handle);
+    ps.count--;
+}
+
+// COLUMNAR PERSON STORE - Struct-of-arrays mirror for report scans
+// Walking the person records visits one heap node per person and drags names and
+// complaints through the cache just to read a flag. Reports instead run over
+// a few packed columns, kept current by onPersonChanged()/onPersonRemoved()
+// at every point a record changes. The summary loop has no branches, so the
+// compiler can vectorize it.
+// Time Complexity: O(1) per update, O(n) per scan over n * 10 bytes (age, score, two flags)
+// Space Complexity: O(n)
+void setPersonRow(PersonColumns& cols, int row, const Homeless& h) {
+    cols.id[row] = h.id;
+    cols.age[row] = h.age;
+    cols.priorityScore[row] = h.priorityScore;
+    cols.locationNodeID[row] = h.locationNodeID;
+    cols.allocated[row] = h.allocated;
+    cols.medicalNeed[row] = h.medicalNeed;
+}
+
+void upsertPersonColumns(PersonColumns& cols, int handle, const Homeless& h) {
+    if (handle >= cols.rowOfHandle.size()) cols.rowOfHandle.resize(handle + 1, -1);
+    int row = cols.rowOfHandle[handle];
+    if (row < 0) {
+        row = cols.id.size();
+        cols.rowOfHandle[handle] = row;
+        cols.handle.push_back(handle);
+        cols.id.push_back(0);
+        cols.age.push_back(0);
+        cols.priorityScore.push_back(0);
+        cols.locationNodeID.push_back(0);
+        cols.allocated.push_back(0);
+        cols.medicalNeed.push_back(0);
+    }
+    setPersonRow(cols, row, h);
+}
+
+// Moves the last row into the gap so the columns stay dense
+void erasePersonColumns(PersonColumns& cols, int handle) {
+    if (handle >= cols.rowOfHandle.size() || cols.rowOfHandle[handle] < 0) return;
+    
+    int row = cols.rowOfHandle[handle], last = cols.id.size() - 1;
+    cols.rowOfHandle[handle] = -1;
+    if (row != last) {
+        cols.id[row] = cols.id[last];
+        cols.age[row] = cols.age[last];
+        cols.priorityScore[row] = cols.priorityScore[last];
+        cols.locationNodeID[row] = cols.locationNodeID[last];
+        cols.allocated[row] = cols.allocated[last];
+        cols.medicalNeed[row] = cols.medicalNeed[last];
+        cols.handle[row] = cols.handle[last];
+        cols.rowOfHandle[cols.handle[row]] = row;
+    }
+    cols.handle.pop_back();
+    cols.id.pop_back();
+    cols.age.pop_back();
+    cols.priorityScore.pop_back();
+    cols.locationNodeID.pop_back();
+    cols.allocated.pop_back();
+    cols.medicalNeed.pop_back();
+}
+
+PersonSummary summarizePersons(const PersonColumns& cols) {
+    PersonSummary sum = {};
+    int n = cols.id.size();
+    const int* age = cols.age.data();
+    const int* priority = cols.priorityScore.data();
+    const unsigned char* allocated = cols.allocated.data();
+    const unsigned char* medical = cols.medicalNeed.data();
+    
+    int band1 = 0, band2 = 0, band3 = 0;
+    for (int i = 0; i < n; i++) {
+        int high = priority[i] > 80;
+        sum.allocated += allocated[i];
+        sum.medical += medical[i];
+        sum.children += age[i] < 18;
+        sum.highPriority += high;
+        sum.highPriorityAllocated += high & allocated[i];
+        band1 += priority[i] >= 40;
+        band2 += priority[i] >= 70;
+        band3 += priority[i] >= 100;
+    }
+    
+    sum.total = n;
+    sum.priorityBand[0] = n - band1;
+    sum.priorityBand[1] = band1 - band2;
+    sum.priorityBand[2] = band2 - band3;
+    sum.priorityBand[3] = band3;
+    return sum;
+}
+
+// The same summary taken record by record, kept as the benchmark baseline
+PersonSummary summarizePersons(const unordered_map<int, Homeless>& records) {
+    PersonSummary sum = {};
+    for (const auto& pair : records) {
+        const Homeless& h = pair.second;
+        if (h.allocated) sum.allocated++;
+        if (h.medicalNeed) sum.medical++;
+        if (h.age < 18) sum.children++;
+        if (h.priorityScore > 80) {
+            sum.highPriority++;
+            if (h.allocated) sum.highPriorityAllocated++;
+        }
+        
+        int p = h.priorityScore;
+        if (p >= 100) sum.priorityBand[3]++;
+        else if (p >= 70) sum.priorityBand[2]++;
+        else if (p >= 40) sum.priorityBand[1]++;
+        else sum.priorityBand[0]++;
+    }
+    sum.total = records.size();
+    return sum;
+}
+
+// Times both summaries over `count` synthetic persons
+void benchmarkPersonScans(int count) {
+    printSubHeader("Report Scan Benchmark: Hash Map vs Columns");
+    
+    mt19937 rng(7);
+    unordered_map<int, Homeless> records;
+    PersonColumns cols;
+    records.reserve(count);
+    for (int i = 0; i < count; i++) {
+        Homeless h = {i, "Person", (int)(rng() % 90), (rng() % 2) ? "Male" : "Female", 0, 
+                      rng() % 5 == 0, (int)(rng() % 200), "Need shelter", 0, rng() % 3 == 0, -1};
+        records[h.id] = h;
+        upsertPersonColumns(cols, i, h);
+    }
+    
+    const int reps = 5;
+    double ms[2];
+    PersonSummary result[2];
+    for (int variant = 0; variant < 2; variant++) {
+        auto start = chrono::steady_clock::now();
+        for (int r = 0; r < reps; r++) {
+            result[variant] = variant == 0 ? summarizePersons(records) : summarizePersons(cols);
+        }
+        ms[variant] = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count() / reps;
+    }
+    
+    cout << "Records: " << count << "\n\n";
+    cout << left << setw(31) << "Layout" << setw(14) << "Scan (ms)" << setw(14) << "Bytes/record" << "\n";
+    cout << string(59, '-') << "\n";
+    cout << left << setw(31) << "unordered_map<int, Homeless>" << fixed << setprecision(2) << setw(14) << ms[0] 
+         << setw(14) << sizeof(Homeless) << "\n";
+    cout << left << setw(31) << "Columns (scanned fields)" << setw(14) << ms[1] 
+         << setw(14) << 2 * sizeof(int) + 2 * sizeof(unsigned char) << "\n";
+    cout << "\nSpeedup: " << setprecision(1) << (ms[1] > 0 ? ms[0] / ms[1] : 0) << "x\n";
+    
+    bool same = result[0].allocated == result[1].allocated && result[0].medical == result[1].medical 
+             && result[0].children == result[1].children && result[0].highPriorityAllocated == result[1].highPriorityAllocated;
+    for (int b = 0; b < 4; b++) same = same && result[0].priorityBand[b] == result[1].priorityBand[b];
+    if (same) {
+        printSuccess("Both layouts produce the same summary");
+    } else {
+        printError("Summaries differ!");
+    }
+}
+
+// SECONDARY PERSON INDEXES - Node buckets, priority order statistics,
+// unallocated set
+// Listings by area, by priority and of persons still waiting visit only the
+// matching records instead of the whole store.
+// Time Complexity: O(log P) per update (P = PRIORITY_LEVELS),
+//                  O(log P) counts and k-th highest, O(k) bucket listings
+// Space Complexity: O(n + nodes + P)
+void bucketAdd(vector<int>& bucket, vector<int>& pos, int handle) {
+    pos[handle] = bucket.size();
+    bucket.push_back(handle);
+}
+
+void bucketRemove(vector<int>& bucket, vector<int>& pos, int handle) {
+    int at = pos[handle];
+    bucket[at] = bucket.back();
+    pos[bucket[at]] = at;
+    bucket.pop_back();
+    pos[handle] = -1;
+}
+
+int priorityLevel(int score) {
+    return min(max(score, 0), PRIORITY_LEVELS - 1);
+}
+
+void priorityTreeAdd(PersonIndexes& idx, int level, int delta) {
+    for (int i = level + 1; i <= PRIORITY_LEVELS; i += i & -i) idx.priorityTree[i] += delta;
+}
+
+// Persons filed at levels <= level
+int priorityTreeCount(const PersonIndexes& idx, int level) {
+    int count = 0;
+    for (int i = level + 1; i > 0; i -= i & -i) count += idx.priorityTree[i];
+    return count;
+}
+
+void indexPerson(PersonIndexes& idx, int handle, const Homeless& h) {
+    if (idx.atPriority.empty()) {
+        idx.atPriority.resize(PRIORITY_LEVELS);
+        idx.priorityTree.assign(PRIORITY_LEVELS + 1, 0);
+    }
+    if (handle >= idx.node.size()) {
+        idx.node.resize(handle + 1, -1);
+        idx.nodePos.resize(handle + 1, -1);
+        idx.level.resize(handle + 1, -1);
+        idx.levelPos.resize(handle + 1, -1);
+        idx.unallocatedPos.resize(handle + 1, -1);
+    }
+    
+    if (idx.node[handle] != h.locationNodeID) {
+        if (idx.node[handle] >= 0) bucketRemove(idx.atNode[idx.node[handle]], idx.nodePos, handle);
+        if (h.locationNodeID >= idx.atNode.size()) idx.atNode.resize(h.locationNodeID + 1);
+        bucketAdd(idx.atNode[h.locationNodeID], idx.nodePos, handle);
+        idx.node[handle] = h.locationNodeID;
+    }
+    
+    int level = priorityLevel(h.priorityScore);
+    if (idx.level[handle] != level) {
+        if (idx.level[handle] >= 0) {
+            bucketRemove(idx.atPriority[idx.level[handle]], idx.levelPos, handle);
+            priorityTreeAdd(idx, idx.level[handle], -1);
+        }
+        bucketAdd(idx.atPriority[level], idx.levelPos, handle);
+        priorityTreeAdd(idx, level, 1);
+        idx.level[handle] = level;
+    }
+    
+    bool waiting = !h.allocated;
+    if (waiting && idx.unallocatedPos[handle] < 0) {
+        bucketAdd(idx.unallocated, idx.unallocatedPos, handle);
+    } else if (!waiting && idx.unallocatedPos[handle] >= 0) {
+        bucketRemove(idx.unallocated, idx.unallocatedPos, handle);
+    }
+}
+
+void unindexPerson(PersonIndexes& idx, int handle) {
+    if (handle >= idx.node.size() || idx.node[handle] < 0) return;
+    
+    bucketRemove(idx.atNode[idx.node[handle]], idx.nodePos, handle);
+    idx.node[handle] = -1;
+    bucketRemove(idx.atPriority[idx.level[handle]], idx.levelPos, handle);
+    priorityTreeAdd(idx, idx.level[handle], -1);
+    idx.level[handle] = -1;
+    if (idx.unallocatedPos[handle] >= 0) bucketRemove(idx.unallocated, idx.unallocatedPos, handle);
+}
+
+// NEAR-DUPLICATE DETECTION - Rolling-hash shingles, MinHash, LSH buckets
+// Names and complaints are cut into overlapping k-character shingles, each
+// hashed from the previous one by rolling the window as rabinKarpSearch
+// does. A minhash is the smallest value one hash function takes over the
+// shingles; two texts agree on it with probability equal to the Jaccard
+// similarity of their shingle sets. Records whose name signatures agree on a
+// whole band land in the same bucket, so a check compares only against those.
+// Time Complexity: O(length * hashes) per signature, O(bands + candidates) per check
+// Space Complexity: O(n * (DUP_SIGNATURE + DUP_BANDS))
+const int DUP_NAME_SHINGLE = 3;
+const int DUP_COMPLAINT_SHINGLE = 4;
+const double DUP_NAME_THRESHOLD = 0.5;      // least estimated name similarity reported
+const double DUP_MATCH_THRESHOLD = 0.6;     // least (2 * name + complaint) / 3
+
+// Multiplier and offset per hash function; fixed so signatures are repeatable
+const unsigned long long* minHashSeeds() {
+    static const array<unsigned long long, 2 * DUP_SIGNATURE> seeds = [] {
+        array<unsigned long long, 2 * DUP_SIGNATURE> s;
+        mt19937_64 rng(24);
+        for (unsigned long long& seed : s) seed = rng() | 1;
+        return s;
+    }();
+    return seeds.data();
+}
+
+// Lowercase letters and digits, one space between words and one at each end
+string normalizeForShingles(const string& text) {
+    string out = " ";
+    for (unsigned char c : text) {
+        if (isalnum(c)) {
+            out += tolower(c);
+        } else if (out.back() != ' ') {
+            out += ' ';
+        }
+    }
+    if (out.back() != ' ') out += ' ';
+    return out;
+}
+
+// sig[j] = least 16-bit value of hash j over the k-shingles of text. The
+// window hash is exact for k <= 7, so equal shingles always hash alike.
+void shingleMinHashes(const string& text, int k, const unsigned long long* seeds, int hashes, unsigned short* sig) {
+    for (int j = 0; j < hashes; j++) sig[j] = 0xFFFF;
+    string norm = normalizeForShingles(text);
+    int n = norm.size();
+    k = min(k, n);
+    
+    const unsigned long long d = 257;
+    unsigned long long h = 1, window = 0;
+    for (int i = 0; i < k - 1; i++) h *= d;
+    for (int i = 0; i < n; i++) {
+        if (i >= k) window -= (unsigned char)norm[i - k] * h;
+        window = window * d + (unsigned char)norm[i];
+        if (i < k - 1) continue;
+        for (int j = 0; j < hashes; j++) {
+            unsigned short v = (window * seeds[2 * j] + seeds[2 * j + 1]) >> 48;
+            if (v < sig[j]) sig[j] = v;
+        }
+    }
+}
+
+void duplicateSignature(const string& name, const string& complaint, unsigned short* sig) {
+    const unsigned long long* seeds = minHashSeeds();
+    shingleMinHashes(name, DUP_NAME_SHINGLE, seeds, DUP_NAME_HASHES, sig);
+    shingleMinHashes(complaint, DUP_COMPLAINT_SHINGLE, seeds + 2 * DUP_NAME_HASHES, DUP_COMPLAINT_HASHES, 
+                     sig + DUP_NAME_HASHES);
+}
+
+// The band's minhashes and number packed, then Fibonacci-hashed
+unsigned int bandKeyOf(const unsigned short* sig, int band) {
+    unsigned long long packed = band;
+    for (int r = 0; r < DUP_ROWS; r++) packed = packed << 16 | sig[band * DUP_ROWS + r];
+    return (packed * 11400714819323198485ULL) >> 32;
+}
+
+void duplicateLink(DuplicateIndex& d, int entry) {
+    int& head = d.bucketHead[d.bandKey[entry] & (d.bucketHead.size() - 1)];
+    d.nextEntry[entry] = head;
+    head = entry;
+}
+
+void duplicateUnlink(DuplicateIndex& d, int entry) {
+    int* link = &d.bucketHead[d.bandKey[entry] & (d.bucketHead.size() - 1)];
+    while (*link != entry) link = &d.nextEntry[*link];
+    *link = d.nextEntry[entry];
+}
+
+// Keeps about one entry per bucket: doubles the buckets and relinks
+void duplicateGrow(DuplicateIndex& d) {
+    d.bucketHead.assign(max<size_t>(1024, d.bucketHead.size() * 2), -1);
+    for (int handle = 0; handle < d.indexed.size(); handle++) {
+        if (!d.indexed[handle]) continue;
+        for (int band = 0; band < DUP_BANDS; band++) duplicateLink(d, handle * DUP_BANDS + band);
+    }
+}
+
+void duplicateRemove(DuplicateIndex& d, int handle) {
+    if (handle >= d.indexed.size() || !d.indexed[handle]) return;
+    for (int band = 0; band < DUP_BANDS; band++) duplicateUnlink(d, handle * DUP_BANDS + band);
+    d.indexed[handle] = 0;
+    d.count--;
+}
+
+// Files (or re-files) a record; a no-op when name and complaint hash the same
+void duplicateAdd(DuplicateIndex& d, int handle, const string& name, const string& complaint) {
+    unsigned short sig[DUP_SIGNATURE];
+    duplicateSignature(name, complaint, sig);
+    if (handle < d.indexed.size() && d.indexed[handle] && 
+        equal(sig, sig + DUP_SIGNATURE, d.signature.begin() + handle * DUP_SIGNATURE)) return;
+    
+    duplicateRemove(d, handle);
+    if (handle >= d.indexed.size()) {
+        d.indexed.resize(handle + 1, 0);
+        d.seenBy.resize(handle + 1, 0);
+        d.signature.resize((handle + 1) * DUP_SIGNATURE);
+        d.bandKey.resize((handle + 1) * DUP_BANDS);
+        d.nextEntry.resize((handle + 1) * DUP_BANDS);
+    }
+    if ((d.count + 1) * DUP_BANDS > d.bucketHead.size()) duplicateGrow(d);
+    
+    copy(sig, sig + DUP_SIGNATURE, d.signature.begin() + handle * DUP_SIGNATURE);
+    for (int band = 0; band < DUP_BANDS; band++) {
+        int entry = handle * DUP_BANDS + band;
+        d.bandKey[entry] = bandKeyOf(sig, band);
+        duplicateLink(d, entry);
+    }
+    d.indexed[handle] = 1;
+    d.count++;
+}
+
+// Records that look like the same person, most similar first. `compared`
+// (if given) receives how many distinct candidates the buckets produced.
+vector<DuplicateMatch> findNearDuplicates(DuplicateIndex& d, const string& name, const string& complaint, 
+                                          int* compared = nullptr) {
+    vector<DuplicateMatch> matches;
+    if (compared) *compared = 0;
+    if (d.count == 0) return matches;
+    
+    unsigned short sig[DUP_SIGNATURE];
+    duplicateSignature(name, complaint, sig);
+    int query = ++d.queries;
+    for (int band = 0; band < DUP_BANDS; band++) {
+        unsigned int key = bandKeyOf(sig, band);
+        for (int entry = d.bucketHead[key & (d.bucketHead.size() - 1)]; entry >= 0; entry = d.nextEntry[entry]) {
+            int handle = entry / DUP_BANDS;
+            if (d.bandKey[entry] != key || d.seenBy[handle] == query) continue;
+            d.seenBy[handle] = query;
+            if (compared) (*compared)++;
+            
+            const unsigned short* other = &d.signature[handle * DUP_SIGNATURE];
+            int nameAgree = 0, complaintAgree = 0;
+            for (int j = 0; j < DUP_NAME_HASHES; j++) nameAgree += sig[j] == other[j];
+            for (int j = DUP_NAME_HASHES; j < DUP_SIGNATURE; j++) complaintAgree += sig[j] == other[j];
+            
+            DuplicateMatch m = {handle, (double)nameAgree / DUP_NAME_HASHES, 
+                                (double)complaintAgree / DUP_COMPLAINT_HASHES};
+            if (m.nameSimilarity >= DUP_NAME_THRESHOLD && 
+                (2 * m.nameSimilarity + m.complaintSimilarity) / 3 >= DUP_MATCH_THRESHOLD) {
+                matches.push_back(m);
+            }
+        }
+    }
+    sort(matches.begin(), matches.end(), [](const DuplicateMatch& a, const DuplicateMatch& b) {
+        return 2 * a.nameSimilarity + a.complaintSimilarity > 2 * b.nameSimilarity + b.complaintSimilarity;
+    });
+    return matches;
+}
+
+// Indexes `count` synthetic persons, then times checks of re-registrations
+// (one typo in the name, complaint reworded) and of new persons, and
+// compares a check against scanning every signature
+void benchmarkDuplicateCheck(int count) {
+    printSubHeader("Duplicate Check Benchmark (MinHash + LSH)");
+    
+    const char* syllables[] = {"ra", "me", "sh", "ku", "mar", "la", "ksh", "mi", "de", "vi", "an", "ita", 
+                               "su", "re", "ee", "ra", "jo", "han", "pri", "ya", "gu", "pta", "sin", "gh"};
+    const char* words[] = {"need", "food", "urgently", "medical", "help", "looking", "for", "shelter", "no", 
+                           "place", "to", "stay", "child", "alone", "sick", "cold", "lost", "job", "family", "night"};
+    const int syllableCount = sizeof(syllables) / sizeof(syllables[0]);
+    const int wordCount = sizeof(words) / sizeof(words[0]);
+    mt19937 rng(24);
+    auto makeName = [&]() {
+        string name;
+        for (int part = 0; part < 2; part++) {
+            string word;
+            int parts = 2 + rng() % 2 + part;
+            for (int i = 0; i < parts; i++) word += syllables[rng() % syllableCount];
+            word[0] = toupper(word[0]);
+            name += (part ? " " : "") + word;
+        }
+        return name;
+    };
+    auto makeComplaint = [&]() {
+        string complaint;
+        int length = 3 + rng() % 6;
+        for (int i = 0; i < length; i++) complaint += (i ? " " : "") + string(words[rng() % wordCount]);
+        return complaint;
+    };
+    
+    vector<string> names(count), complaints(count);
+    for (int i = 0; i < count; i++) {
+        names[i] = makeName();
+        complaints[i] = makeComplaint();
+    }
+    
+    DuplicateIndex d;
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < count; i++) duplicateAdd(d, i, names[i], complaints[i]);
+    double indexMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    size_t bytes = d.signature.capacity() * sizeof(unsigned short) + d.bandKey.capacity() * sizeof(unsigned int) 
+                 + (d.nextEntry.capacity() + d.bucketHead.capacity() + d.seenBy.capacity()) * sizeof(int) 
+                 + d.indexed.capacity();
+    cout << "Indexed " << count << " persons in " << fixed << setprecision(1) << indexMs << " ms (" 
+         << (double)bytes / count << " bytes/person)\n\n";
+    
+    // Re-registrations: one letter of the name changed, complaint words dropped or added
+    const int checks = 2000;
+    vector<int> original(checks);
+    vector<string> queryNames(checks), queryComplaints(checks);
+    for (int q = 0; q < checks; q++) {
+        original[q] = rng() % count;
+        string name = names[original[q]];
+        int at = rng() % name.size();
+        if (name[at] != ' ') name[at] = 'a' + rng() % 26;
+        string complaint = complaints[original[q]];
+        if (rng() % 2) complaint += " " + string(words[rng() % wordCount]);
+        else complaint = complaint.substr(complaint.find(' ') + 1);
+        queryNames[q] = name;
+        queryComplaints[q] = complaint;
+    }
+    
+    int scanChecks = min(checks, max(10, 20000000 / count));
+    long long candidates = 0, lshMatches = 0;
+    int found = 0;
+    start = chrono::steady_clock::now();
+    for (int q = 0; q < checks; q++) {
+        int compared;
+        vector<DuplicateMatch> matches = findNearDuplicates(d, queryNames[q], queryComplaints[q], &compared);
+        candidates += compared;
+        if (q < scanChecks) lshMatches += matches.size();
+        for (const DuplicateMatch& m : matches) {
+            if (m.handle == original[q]) {
+                found++;
+                break;
+            }
+        }
+    }
+    double lshMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    
+    long long freshCandidates = 0;
+    int flagged = 0;
+    start = chrono::steady_clock::now();
+    for (int q = 0; q < checks; q++) {
+        int compared;
+        flagged += !findNearDuplicates(d, makeName(), makeComplaint(), &compared).empty();
+        freshCandidates += compared;
+    }
+    double freshMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    
+    // Full scan: compare the query signature with every stored one
+    long long scanMatches = 0;
+    int scanFound = 0;
+    start = chrono::steady_clock::now();
+    for (int q = 0; q < scanChecks; q++) {
+        unsigned short sig[DUP_SIGNATURE];
+        duplicateSignature(queryNames[q], queryComplaints[q], sig);
+        for (int handle = 0; handle < count; handle++) {
+            const unsigned short* other = &d.signature[handle * DUP_SIGNATURE];
+            int nameAgree = 0, complaintAgree = 0;
+            for (int j = 0; j < DUP_NAME_HASHES; j++) nameAgree += sig[j] == other[j];
+            for (int j = DUP_NAME_HASHES; j < DUP_SIGNATURE; j++) complaintAgree += sig[j] == other[j];
+            double name = (double)nameAgree / DUP_NAME_HASHES, complaint = (double)complaintAgree / DUP_COMPLAINT_HASHES;
+            if (name >= DUP_NAME_THRESHOLD && (2 * name + complaint) / 3 >= DUP_MATCH_THRESHOLD) {
+                scanMatches++;
+                scanFound += handle == original[q];
+            }
+        }
+    }
+    double scanMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    
+    cout << left << setw(30) << "Check" << setw(14) << "us/check" << setw(14) << "Compared" << "Result\n";
+    cout << string(72, '-') << "\n";
+    cout << left << setw(30) << "Re-registration, LSH" << setw(14) << lshMs * 1000 / checks 
+         << setw(14) << (double)candidates / checks << found * 100.0 / checks << "% found\n";
+    cout << left << setw(30) << "Re-registration, full scan" << setw(14) << scanMs * 1000 / scanChecks 
+         << setw(14) << (double)count << scanFound * 100.0 / scanChecks << "% found\n";
+    cout << left << setw(30) << "New person, LSH" << setw(14) << freshMs * 1000 / checks 
+         << setw(14) << (double)freshCandidates / checks << flagged * 100.0 / checks << "% flagged\n";
+    cout << "\nOn the first " << scanChecks << " re-registrations LSH returned " << lshMatches << " of the " 
+         << scanMatches << " matches a full scan finds.\n";
+    cout << "A flagged new person has a generated name close to an existing one.\n";
+}
+
+// COMPLAINT WORD INDEX - Inverted index with block-compressed posting lists
+// Every lowercase word of a complaint maps to the sorted IDs of the persons
+// whose complaint contains it. IDs are handed out in increasing order, so a
+// new registration appends one varint to each list's last block; any other
+// change decodes and rewrites only the block it falls in, splitting it once
+// it outgrows POSTING_BLOCK. AND walks the shorter list's IDs through the
+// longer list's blocks, decoding only blocks whose [first, last] range holds
+// a candidate; OR merges.
+// Time Complexity: O(words * POSTING_BLOCK) per update,
+//                  O(sum of posting sizes) per query
+// Space Complexity: O(postings), about 1-2 bytes per posting
+void putVarint(vector<unsigned char>& out, unsigned int value) {
+    while (value >= 128) {
+        out.push_back(value | 128);
+        value >>= 7;
+    }
+    out.push_back(value);
+}
+
+// Appends the block's IDs to out
+void decodeBlock(const PostingBlock& b, vector<int>& out) {
+    size_t at = out.size();
+    out.resize(at + b.count);
+    int* ids = &out[at];
+    int id = b.first;
+    ids[0] = id;
+    const unsigned char* p = b.gaps.data();
+    for (int i = 1; i < b.count; i++) {
+        unsigned int gap = *p++;
+        if (gap & 128) {
+            gap &= 127;
+            for (int shift = 7; ; shift += 7) {
+                gap |= (unsigned int)(*p & 127) << shift;
+                if (!(*p++ & 128)) break;
+            }
+        }
+        id += gap;
+        ids[i] = id;
+    }
+}
+
+PostingBlock encodeBlock(const int* ids, int count) {
+    PostingBlock b = {ids[0], ids[count - 1], count, {}};
+    for (int i = 1; i < count; i++) putVarint(b.gaps, ids[i] - ids[i - 1]);
+    return b;
+}
+
+void decodePostings(const PostingList& list, vector<int>& out) {
+    out.reserve(out.size() + list.size);
+    for (const PostingBlock& b : list.blocks) decodeBlock(b, out);
+}
+
+// The last block starting at or before id (0 if id precedes them all)
+int postingBlockFor(const PostingList& list, int id) {
+    auto it = upper_bound(list.blocks.begin(), list.blocks.end(), id, 
+                          [](int value, const PostingBlock& b) { return value < b.first; });
+    return max(0, (int)(it - list.blocks.begin()) - 1);
+}
+
+void postingInsert(PostingList& list, int id) {
+    if (list.blocks.empty() || id > list.blocks.back().last) {
+        if (list.blocks.empty() || list.blocks.back().count == POSTING_BLOCK) {
+            list.blocks.push_back({id, id, 1, {}});
+        } else {
+            PostingBlock& b = list.blocks.back();
+            putVarint(b.gaps, id - b.last);
+            b.last = id;
+            b.count++;
+        }
+        list.size++;
+        return;
+    }
+    
+    int at = postingBlockFor(list, id);
+    vector<int> ids;
+    decodeBlock(list.blocks[at], ids);
+    auto pos = lower_bound(ids.begin(), ids.end(), id);
+    if (pos != ids.end() && *pos == id) return;
+    ids.insert(pos, id);
+    list.size++;
+    if (ids.size() <= POSTING_BLOCK) {
+        list.blocks[at] = encodeBlock(ids.data(), ids.size());
+    } else {
+        int half = ids.size() / 2;
+        list.blocks[at] = encodeBlock(ids.data(), half);
+        list.blocks.insert(list.blocks.begin() + at + 1, encodeBlock(ids.data() + half, ids.size() - half));
+    }
+}
+
+void postingRemove(PostingList& list, int id) {
+    if (list.blocks.empty()) return;
+    int at = postingBlockFor(list, id);
+    if (id < list.blocks[at].first || id > list.blocks[at].last) return;
+    
+    vector<int> ids;
+    decodeBlock(list.blocks[at], ids);
+    auto pos = lower_bound(ids.begin(), ids.end(), id);
+    if (pos == ids.end() || *pos != id) return;
+    ids.erase(pos);
+    list.size--;
+    if (ids.empty()) {
+        list.blocks.erase(list.blocks.begin() + at);
+    } else {
+        list.blocks[at] = encodeBlock(ids.data(), ids.size());
+    }
+}
+
+// IDs of `ids` (sorted) that are also in `list`
+vector<int> intersectPostings(const vector<int>& ids, const PostingList& list) {
+    vector<int> out, block;
+    size_t i = 0;
+    for (const PostingBlock& b : list.blocks) {
+        if (i == ids.size()) break;
+        if (b.last < ids[i]) continue;
+        while (i < ids.size() && ids[i] < b.first) i++;
+        size_t end = i;
+        while (end < ids.size() && ids[end] <= b.last) end++;
+        if (end == i) continue;
+        
+        block.clear();
+        decodeBlock(b, block);
+        set_intersection(ids.begin() + i, ids.begin() + end, block.begin(), block.end(), back_inserter(out));
+        i = end;
+    }
+    return out;
+}
+
+// Calls f(word) for each lowercase word (run of letters and digits) in
+// text; `word` is one buffer reused for every call
+template <class F>
+void forEachWord(const string& text, F f) {
+    string word;
+    size_t i = 0;
+    while (i < text.size()) {
+        if (!isalnum((unsigned char)text[i])) {
+            i++;
+            continue;
+        }
+        word.clear();
+        for (; i < text.size() && isalnum((unsigned char)text[i]); i++) word += tolower((unsigned char)text[i]);
+        f(word);
+    }
+}
+
+// Distinct lowercase words, sorted
+vector<string> complaintWords(const string& text) {
+    vector<string> words;
+    forEachWord(text, [&](const string& word) { words.push_back(word); });
+    sort(words.begin(), words.end());
+    words.erase(unique(words.begin(), words.end()), words.end());
+    return words;
+}
+
+// Takes `id` off a word's list; a word left with no persons is forgotten and
+// its number reused, so the vocabulary tracks the complaints on file
+void complaintTermRemove(ComplaintIndex& x, int term, int id) {
+    postingRemove(x.postings[term], id);
+    if (x.postings[term].size > 0) return;
+    x.termOf.erase(x.terms[term]);
+    x.terms[term].clear();
+    x.freeTerms.push_back(term);
+}
+
+// Files the record in `handle` (person `id`) under the words of its
+// complaint, touching only the lists of words added or dropped
+void complaintIndexUpdate(ComplaintIndex& x, int handle, int id, const string& complaint) {
+    vector<int> now;
+    forEachWord(complaint, [&](const string& word) {
+        auto it = x.termOf.find(word);
+        if (it != x.termOf.end()) {
+            now.push_back(it->second);
+        } else if (!x.freeTerms.empty()) {
+            int term = x.freeTerms.back();
+            x.freeTerms.pop_back();
+            now.push_back(term);
+            x.termOf.emplace(word, term);
+            x.terms[term] = word;
+        } else {
+            now.push_back(x.terms.size());
+            x.termOf.emplace(word, x.terms.size());
+            x.terms.push_back(word);
+            x.postings.emplace_back();
+        }
+    });
+    sort(now.begin(), now.end());
+    now.erase(unique(now.begin(), now.end()), now.end());
+    
+    if (handle >= x.termsOfHandle.size()) x.termsOfHandle.resize(handle + 1);
+    vector<int>& before = x.termsOfHandle[handle];
+    if (before == now) return;
+    
+    vector<int> dropped, added;
+    set_difference(before.begin(), before.end(), now.begin(), now.end(), back_inserter(dropped));
+    set_difference(now.begin(), now.end(), before.begin(), before.end(), back_inserter(added));
+    for (int term : dropped) complaintTermRemove(x, term, id);
+    for (int term : added) postingInsert(x.postings[term], id);
+    before = now;
+}
+
+void complaintIndexRemove(ComplaintIndex& x, int handle, int id) {
+    if (handle >= x.termsOfHandle.size()) return;
+    for (int term : x.termsOfHandle[handle]) complaintTermRemove(x, term, id);
+    x.termsOfHandle[handle].clear();
+}
+
+// Person IDs (sorted) matching a query of words, where words in a group must
+// all appear and groups are separated by OR: "insulin cold OR diabetic" is
+// (insulin AND cold) OR diabetic. An explicit AND between words is allowed.
+vector<int> queryComplaintIndex(const ComplaintIndex& x, const string& query) {
+    vector<vector<string>> groups(1);
+    istringstream in(query);
+    string token;
+    while (in >> token) {
+        if (token == "OR" || token == "|") {
+            groups.emplace_back();
+        } else if (token != "AND" && token != "&") {
+            for (const string& word : complaintWords(token)) groups.back().push_back(word);
+        }
+    }
+    
+    vector<int> result, merged;
+    for (const vector<string>& group : groups) {
+        if (group.empty()) continue;
+        vector<const PostingList*> lists;
+        for (const string& word : group) {
+            auto it = x.termOf.find(word);
+            lists.push_back(it == x.termOf.end() ? nullptr : &x.postings[it->second]);
+        }
+        if (find(lists.begin(), lists.end(), nullptr) != lists.end()) continue;
+        
+        // Shortest list first, so every step only narrows the candidates
+        sort(lists.begin(), lists.end(), [](const PostingList* a, const PostingList* b) { return a->size < b->size; });
+        vector<int> ids;
+        decodePostings(*lists[0], ids);
+        for (int k = 1; k < lists.size() && !ids.empty(); k++) ids = intersectPostings(ids, *lists[k]);
+        
+        if (result.empty()) {
+            result.swap(ids);
+        } else {
+            merged.clear();
+            set_union(result.begin(), result.end(), ids.begin(), ids.end(), back_inserter(merged));
+            result.swap(merged);
+        }
+    }
+    return result;
+}
+
+size_t complaintIndexBytes(const ComplaintIndex& x) {
+    size_t bytes = 0;
+    for (const PostingList& list : x.postings) {
+        bytes += list.blocks.capacity() * sizeof(PostingBlock);
+        for (const PostingBlock& b : list.blocks) bytes += b.gaps.capacity();
+    }
+    return bytes;
+}
+
+// Builds an index over `count` synthetic complaints, then times AND/OR
+// queries against tokenizing and checking every complaint
+void benchmarkComplaintIndex(int count) {
+    printSubHeader("Complaint Word Index Benchmark");
+    
+    // A few hundred everyday words, with frequencies falling off like real text
+    const char* common[] = {"need", "food", "help", "shelter", "cold", "night", "sick", "child", "medical", "job", 
+                            "lost", "family", "alone", "stay", "bed", "pain", "rain", "money", "water", "urgent"};
+    const char* rare[] = {"insulin", "diabetic", "asthma", "inhaler", "pregnant", "wheelchair", "crutches", 
+                          "dialysis", "epilepsy", "stolen"};
+    mt19937 rng(25);
+    vector<string> complaints(count);
+    size_t bytesOfText = 0;
+    for (string& c : complaints) {
+        int length = 4 + rng() % 12;
+        for (int w = 0; w < length; w++) {
+            if (w) c += ' ';
+            int pick = rng() % 1000;
+            if (pick < 5) {
+                c += rare[rng() % 10];
+            } else if (pick < 600) {
+                c += common[min(rng() % 20, rng() % 20)];
+            } else {
+                c += "w" + to_string(min(rng() % 500, rng() % 500));
+            }
+        }
+        bytesOfText += c.size();
+    }
+    
+    ComplaintIndex x;
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < count; i++) complaintIndexUpdate(x, i, 101 + i, complaints[i]);
+    double buildMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    long long postings = 0;
+    for (const PostingList& list : x.postings) postings += list.size;
+    size_t bytes = complaintIndexBytes(x);
+    cout << count << " complaints (" << fixed << setprecision(1) << bytesOfText / 1e6 << " MB), " << x.termOf.size() 
+         << " words, " << postings << " postings\n";
+    cout << "Built in " << buildMs << " ms; posting lists " << bytes / 1e6 << " MB (" << setprecision(2) 
+         << (double)bytes / postings << " bytes/posting vs 4 uncompressed)\n\n";
+    
+    const char* queries[] = {"insulin", "insulin cold", "food night", "asthma OR inhaler", "need help OR urgent", 
+                             "dialysis pain OR epilepsy child"};
+    cout << left << setw(34) << "Query" << setw(10) << "Matches" << setw(14) << "Index (ms)" << setw(14) << "Scan (ms)" << "\n";
+    cout << string(72, '-') << "\n";
+    bool same = true;
+    for (const char* query : queries) {
+        start = chrono::steady_clock::now();
+        vector<int> found = queryComplaintIndex(x, query);
+        double indexMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        
+        // Scan: the same words-and-groups test on every complaint
+        vector<vector<string>> groups(1);
+        istringstream in(query);
+        string token;
+        while (in >> token) {
+            if (token == "OR") groups.emplace_back();
+            else groups.back().push_back(token);
+        }
+        start = chrono::steady_clock::now();
+        vector<int> scanned;
+        for (int i = 0; i < count; i++) {
+            vector<string> words = complaintWords(complaints[i]);
+            for (const vector<string>& group : groups) {
+                bool all = true;
+                for (const string& word : group) all = all && binary_search(words.begin(), words.end(), word);
+                if (all) {
+                    scanned.push_back(101 + i);
+                    break;
+                }
+            }
+        }
+        double scanMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        same = same && scanned == found;
+        
+        cout << left << setw(34) << query << setw(10) << found.size() << setprecision(3) << setw(14) << indexMs 
+             << setprecision(1) << setw(14) << scanMs << "\n";
+    }
+    
+    if (same) {
+        printSuccess("Index and scan found the same persons");
+    } else {
+        printError("Index and scan results differ!");
+    }
+}
+
+// Brings the views of the record in `handle` that follow its location,
+// score and allocation up to date
+void refreshPersonIndexes(int handle) {
+    const Homeless& h = personAt(handle);
+    upsertPersonColumns(personColumns, handle, h);
+    indexPerson(personIndexes, handle, h);
+}
+
+// Brings the views built from the record's text (duplicate signatures and
+// complaint words) up to date; only a new name or complaint changes them
+void refreshPersonText(int handle) {
+    const Homeless& h = personAt(handle);
+    duplicateAdd(duplicateIndex, handle, h.name, h.complaint);
+    complaintIndexUpdate(complaintIndex, handle, h.id, h.complaint);
+}
+
+// Call after a stored record is modified
+void onPersonChanged(int personID) {
+    int handle = personHandle(personID);
+    if (handle >= 0) refreshPersonIndexes(handle);
+}
+
+// Call as well when the record's name or complaint was edited
+void onPersonTextChanged(int personID) {
+    int handle = personHandle(personID);
+    if (handle >= 0) refreshPersonText(handle);
+}
+
+// Call just before a record's slot is released
+void onPersonRemoved(int handle) {
+    erasePersonColumns(personColumns, handle);
+    unindexPerson(personIndexes, handle);
+    duplicateRemove(duplicateIndex, handle);
+    complaintIndexRemove(complaintIndex, handle, personAt(handle).id);
+}
+
+// Handles of everyone registered at a location node
+const vector<int>& personsAtNode(int node) {
+    static const vector<int> none;
+    if (node < 0 || node >= personIndexes.atNode.size()) return none;
+    return personIndexes.atNode[node];
+}
+
+// Handles of everyone not yet allocated a shelter
+const vector<int>& unallocatedPersons() {
+    return personIndexes.unallocated;
+}
+
+int countPriorityAbove(int threshold) {
+    if (personIndexes.priorityTree.empty()) return 0;
+    if (threshold >= PRIORITY_LEVELS - 1) {
+        int count = 0;
+        for (int handle : personIndexes.atPriority[PRIORITY_LEVELS - 1]) {
+            if (personAt(handle).priorityScore > threshold) count++;
+        }
+        return count;
+    }
+    return personCount() - priorityTreeCount(personIndexes, max(threshold, -1));
+}
+
+// Priority score of the k-th highest-priority person (k from 1), or -1;
+// scores at or above the last level are reported as that level
+int kthHighestPriority(int k) {
+    int n = personCount();
+    if (k < 1 || k > n || personIndexes.priorityTree.empty()) return -1;
+    
+    // Find the smallest level whose prefix count reaches the (n-k+1)-th smallest
+    int target = n - k + 1, pos = 0;
+    for (int step = PRIORITY_LEVELS; step > 0; step >>= 1) {
+        if (pos + step <= PRIORITY_LEVELS && personIndexes.priorityTree[pos + step] < target) {
+            pos += step;
+            target -= personIndexes.priorityTree[pos];
+        }
+    }
+    return pos;
+}
+
+// Handles of everyone with priority > threshold, highest first
+vector<int> personsAbovePriority(int threshold) {
+    vector<int> handles;
+    if (personIndexes.atPriority.empty()) return handles;
+    
+    // The last level pools every higher score, so it is always checked
+    for (int level = PRIORITY_LEVELS - 1; level >= 0 && (level > threshold || level == PRIORITY_LEVELS - 1); level--) {
+        const vector<int>& bucket = personIndexes.atPriority[level];
+        int first = handles.size();
+        for (int handle : bucket) {
+            if (personAt(handle).priorityScore > threshold) handles.push_back(handle);
+        }
+        if (level == PRIORITY_LEVELS - 1) {
+            sort(handles.begin() + first, handles.end(), [](int a, int b) {
+                return personAt(a).priorityScore > personAt(b).priorityScore;
+            });
+        }
+    }
+    return handles;
+}
+
+// 4️⃣ HASHING - Fast Insert/Search
+// Time Complexity: O(1) average case
+// Space Complexity: O(n)
+bool addHomelessRecord(Homeless h) {
+    if (h.locationNodeID < 0 || h.locationNodeID >= nodeCount) {
+        printError("Invalid location node ID!");
+        return false;
+    }
+    
+    h.allocated = false;
+    h.allocatedShelterID = -1;
+    h.reportedAt = time(0);
+    
+    int handle = insertPerson(h);
+    if (handle < 0) {
+        printError("Duplicate ID detected! Record already exists.");
+        return false;
+    }
+    refreshPersonIndexes(handle);
+    refreshPersonText(handle);
+    printSuccess("Record added successfully: " + h.name + " (ID: " + to_string(h.id) + ")");
+    return true;
+}
+
+Homeless* searchHomeless(int id) {
+    int handle = personHandle(id);
+    if (handle >= 0) {
+        return &personAt(handle);
+    }
+    return nullptr;
+}
+
+bool isDuplicate(int id) {
+    return personHandle(id) >= 0;
+}
+
+// 5️⃣ BINARY SEARCH - Over the maintained sorted ID index
+// Time Complexity: O(log n)
+// Space Complexity: O(1)
+// Returns the person's store handle, or -1
+int binarySearchRecord(int id) {
+    const vector<pair<int, int>>& sortedIDs = sortedPersonIDs();
+    
+    int left = 0, right = sortedIDs.size() - 1;
+    int comparisons = 0;
+    
+    while (left <= right) {
+        comparisons++;
+        int mid = left + (right - left) / 2;
+        if (sortedIDs[mid].first == id) {
+            cout << "Binary Search: Found in " << comparisons << " comparisons\n";
+            return sortedIDs[mid].second;
+        } else if (sortedIDs[mid].first < id) {
+            left = mid + 1;
+        } else {
+            right = mid - 1;
+        }
+    }
+    cout << "Binary Search: Not found after " << comparisons << " comparisons\n";
+    return -1;
+}
+
+// 6️⃣ MERGE SORT - Rank Shelters by Any Key
+// Sorts packed (key, handle) pairs instead of Shelter objects, so names,
+// contacts and allocation lists are never copied and `shelters` keeps its
+// order. One buffer is shared by every level of the recursion. Large inputs
+// are cut into one run per thread, sorted in parallel, then merged pairwise.
+// Ties go to the lower handle.
+// Time Complexity: O(n log n); O((n/p) log n + n log p) on p threads
+// Space Complexity: O(n)
+enum ShelterRankKey {
+    RANK_FREE_BEDS,     // most available beds first
+    RANK_UTILIZATION,   // least occupied (by percentage) first
+    RANK_DISTANCE       // nearest to a given node first
+};
+
+typedef pair<long long, int> RankedShelter; // (key, handle), ascending
+const int PARALLEL_RANK_MIN_SHELTERS = 1 << 15;
+
+void merge(vector<RankedShelter>& arr, vector<RankedShelter>& buffer, int left, int mid, int right) {
+    int i = left, j = mid + 1, k = left;
+    while (i <= mid && j <= right) {
+        if (arr[j] < arr[i]) {
+            buffer[k++] = arr[j++];
+        } else {
+            buffer[k++] = arr[i++];
+        }
+    }
+    
+    while (i <= mid) buffer[k++] = arr[i++];
+    while (j <= right) buffer[k++] = arr[j++];
+    copy(buffer.begin() + left, buffer.begin() + right + 1, arr.begin() + left);
+}
+
+void mergeSort(vector<RankedShelter>& arr, vector<RankedShelter>& buffer, int left, int right) {
+    if (left < right) {
+        int mid = left + (right - left) / 2;
+        mergeSort(arr, buffer, left, mid);
+        mergeSort(arr, buffer, mid + 1, right);
+        merge(arr, buffer, left, mid, right);
+    }
+}
+
+long long shelterRankKey(const Shelter& s, ShelterRankKey key, const vector<int>& dist) {
+    switch (key) {
+        case RANK_FREE_BEDS:
+            return -(long long)freeBeds(s);
+        case RANK_UTILIZATION:
+            // parts per million, so the key stays an integer
+            return s.capacityTotal > 0 ? (long long)s.capacityOccupied * 1000000 / s.capacityTotal : 1000000;
+        case RANK_DISTANCE:
+            return dist[s.nodeID];
+    }
+    return 0;
+}
+
+// Shelter handles in rank order; dist (road distance from the reference
+// node) is only read for RANK_DISTANCE
+vector<int> rankShelters(ShelterRankKey key, const vector<int>& dist, int threadCount) {
+    int n = shelters.size();
+    vector<RankedShelter> ranked(n);
+    for (int i = 0; i < n; i++) {
+        ranked[i] = {shelterRankKey(shelters[i], key, dist), i};
+    }
+    vector<RankedShelter> buffer(n);
+    
+    if (n < PARALLEL_RANK_MIN_SHELTERS) threadCount = 1;
+    threadCount = max(1, threadCount);
+    
+    // Run r covers [bounds[r], bounds[r + 1])
+    vector<int> bounds;
+    for (int t = 0; t <= threadCount; t++) bounds.push_back((long long)n * t / threadCount);
+    
+    // The calling thread takes the last run (and the last merge of each
+    // round) itself, so a single run or a final merge starts no thread
+    vector<thread> workers;
+    for (int t = 0; t + 1 < threadCount; t++) {
+        workers.emplace_back([&, t]() { mergeSort(ranked, buffer, bounds[t], bounds[t + 1] - 1); });
+    }
+    mergeSort(ranked, buffer, bounds[threadCount - 1], n - 1);
+    for (thread& worker : workers) worker.join();
+    
+    while (bounds.size() > 2) {
+        vector<int> merged;
+        vector<tuple<int, int, int>> merges;   // (lo, mid, hi)
+        for (int r = 0; r + 1 < bounds.size(); r += 2) {
+            merged.push_back(bounds[r]);
+            if (r + 2 < bounds.size()) merges.push_back({bounds[r], bounds[r + 1] - 1, bounds[r + 2] - 1});
+        }
+        merged.push_back(n);
+        
+        workers.clear();
+        for (int m = 0; m + 1 < merges.size(); m++) {
+            int lo = get<0>(merges[m]), mid = get<1>(merges[m]), hi = get<2>(merges[m]);
+            workers.emplace_back([&, lo, mid, hi]() { merge(ranked, buffer, lo, mid, hi); });
+        }
+        merge(ranked, buffer, get<0>(merges.back()), get<1>(merges.back()), get<2>(merges.back()));
+        for (thread& worker : workers) worker.join();
+        bounds = merged;
+    }
+    
+    vector<int> handles(n);
+    for (int i = 0; i < n; i++) handles[i] = ranked[i].second;
+    return handles;
+}
+
+void displayShelterRanking(ShelterRankKey key, int fromNode) {
+    printSubHeader("Merge Sort: Ranking Shelters");
+    
+    if (shelters.empty()) {
+        printWarning("No shelters to sort");
+        return;
+    }
+    
+    vector<int> dist;
+    if (key == RANK_DISTANCE) dist = dijkstra(fromNode);
+    vector<int> order = rankShelters(key, dist, thread::hardware_concurrency());
+    
+    cout << left << setw(5) << "Rank" << setw(25) << "Shelter Name" << setw(12) << "Total" 
+         << setw(12) << "Occupied" << setw(12) << "Available" << setw(12) << "Status";
+    if (key == RANK_DISTANCE) cout << setw(10) << "Distance";
+    cout << "\n" << string(key == RANK_DISTANCE ? 88 : 78, '-') << "\n";
+    
+    for (int i = 0; i < order.size(); i++) {
+        const Shelter& s = shelters[order[i]];
+        int available = freeBeds(s);
+        double utilization = (s.capacityOccupied * 100.0) / s.capacityTotal;
+        
+        string status;
+        if (utilization >= 90) status = RED "CRITICAL" RESET;
+        else if (utilization >= 75) status = YELLOW "HIGH" RESET;
+        else status = GREEN "NORMAL" RESET;
+        
+        cout << left << setw(5) << (i+1) << setw(25) << s.name 
+             << setw(12) << s.capacityTotal << setw(12) << s.capacityOccupied 
+             << setw(12) << available << setw(12 + 9) << status;   // 9 chars of colour codes
+        if (key == RANK_DISTANCE) {
+            if (dist[s.nodeID] == INT_MAX) cout << "unreachable";
+            else cout << dist[s.nodeID];
+        }
+        cout << "\n";
+    }
+    
+    const char* names[] = {"available capacity", "utilization", "distance"};
+    printSuccess(string("Shelters ranked by ") + names[key]);
+}
+
+// Ranks random shelter sets by every key and thread count and compares each
+// order with std::sort over the same (key, handle) pairs. Sizes run up past
+// PARALLEL_RANK_MIN_SHELTERS so the parallel runs and merge rounds are
+// covered. The live shelters are swapped out for the duration.
+bool rankSheltersSelfTest(int maxThreads) {
+    CityState live;
+    swapCityState(live);
+    
+    mt19937 rng(13);
+    const int sizes[] = {0, 1, 2, 3, 17, 1000, PARALLEL_RANK_MIN_SHELTERS - 1, PARALLEL_RANK_MIN_SHELTERS + 123, 200000};
+    const ShelterRankKey keys[] = {RANK_FREE_BEDS, RANK_UTILIZATION, RANK_DISTANCE};
+    const char* keyNames[] = {"free beds", "utilization", "distance"};
+    int checks = 0, failures = 0;
+    
+    for (int n : sizes) {
+        // Few distinct keys, so ties (broken by handle) are common
+        shelters.clear();
+        for (int i = 0; i < n; i++) {
+            int capacity = rng() % 40;
+            shelters.push_back({i + 1, "", (int)(rng() % 1000), capacity, capacity ? (int)(rng() % (capacity + 1)) : 0, "", {}});
+        }
+        vector<int> dist(1000);
+        for (int& d : dist) d = rng() % 8 == 0 ? INT_MAX : rng() % 200;
+        
+        for (int k = 0; k < 3; k++) {
+            vector<RankedShelter> expected(n);
+            for (int i = 0; i < n; i++) expected[i] = {shelterRankKey(shelters[i], keys[k], dist), i};
+            sort(expected.begin(), expected.end());
+            
+            for (int threads = 1; threads <= maxThreads; threads++) {
+                vector<int> order = rankShelters(keys[k], dist, threads);
+                bool same = order.size() == n;
+                for (int i = 0; i < n && same; i++) same = order[i] == expected[i].second;
+                checks++;
+                if (!same) {
+                    failures++;
+                    cout << RED << "  " << n << " shelters by " << keyNames[k] << " on " << threads 
+                         << " threads" << RESET << ": order differs\n";
+                }
+            }
+        }
+    }
+    
+    swapCityState(live);
+    cout << checks << " rankings checked, " << failures << " differed\n";
+    return failures == 0;
+}
+
+// 7️⃣ MAX HEAP - Emergency Case Prioritization
+// Time Complexity: O(log n) for insertion, O(1) for peek, O(log n) for extraction
+void addEmergencyCase(EmergencyCase e) {
+    emergencyHeap.push(e);
+    printSuccess("Emergency case added with priority: " + to_string(e.priority));
+}
+
+EmergencyCase getNextEmergency() {
+    if (emergencyHeap.empty()) {
+        return {-1, -1, 0};
+    }
+    EmergencyCase top = emergencyHeap.top();
+    emergencyHeap.pop();
+    return top;
+}
+
+// 8️⃣ RABIN-KARP - Keyword Search in Complaints
+// Time Complexity: O(n + m) average case
+// Space Complexity: O(1)
+bool rabinKarpSearch(const string& text, const string& pattern) {
+    int n = text.length();
+    int m = pattern.length();
+    
+    if (m > n || m == 0) return false;
+    
+    const int d = 256;
+    const int q = 101;
+    
+    int p = 0;
+    int t = 0;
+    int h = 1;
+    
+    for (int i = 0; i < m - 1; i++) {
+        h = (h * d) % q;
+    }
+    
+    for (int i = 0; i < m; i++) {
+        p = (d * p + pattern[i]) % q;
+        t = (d * t + text[i]) % q;
+    }
+    
+    for (int i = 0; i <= n - m; i++) {
+        if (p == t) {
+            bool match = true;
+            for (int j = 0; j < m; j++) {
+                if (text[i + j] != pattern[j]) {
+                    match = false;
+                    break;
+                }
+            }
+            if (match) return true;
+        }
+        
+        if (i < n - m) {
+            t = (d * (t - text[i] * h) + text[i + m]) % q;
+            if (t < 0) t += q;
+        }
+    }
+    
+    return false;
+}
+
+// KEYWORD MATCHING - Aho-Corasick over all priority and category keywords
+// One pass over a complaint finds every keyword, where the Rabin-Karp path
+// made a lowercased copy and ran up to 23 separate searches.
+// Time Complexity: O(total keyword length * 27) to build, O(n) per complaint
+// Space Complexity: O(total keyword length * 27)
+const int MAX_COMPLAINT_KEYWORDS = 64;
+const int MAX_COMPLAINT_CATEGORIES = 31;
+
+// The rules used when no complaint_rules.txt is present
+ComplaintRules defaultComplaintRules() {
+    const int FOOD = 1, MEDICAL = 2, SAFETY = 4, SHELTER = 8;
+    ComplaintRules r;
+    r.categoryNames = {"Food", "Medical", "Safety", "Shelter"};
+    r.rules = {
+        {"emergency", 70, 0},
+        {"critical", 60, 0},
+        {"medical", 50, MEDICAL},
+        {"child", 40, 0},
+        {"urgent", 45, 0},
+        {"danger", 55, SAFETY},
+        {"food", 0, FOOD},
+        {"hungry", 0, FOOD},
+        {"meal", 0, FOOD},
+        {"eat", 0, FOOD},
+        {"sick", 0, MEDICAL},
+        {"medicine", 0, MEDICAL},
+        {"health", 0, MEDICAL},
+        {"doctor", 0, MEDICAL},
+        {"safe", 0, SAFETY},
+        {"threat", 0, SAFETY},
+        {"attack", 0, SAFETY},
+        {"shelter", 0, SHELTER},
+        {"bed", 0, SHELTER},
+        {"sleep", 0, SHELTER},
+        {"stay", 0, SHELTER}
+    };
+    return r;
+}
+
+void buildKeywordMatcher(KeywordMatcher& m, const ComplaintRules& rules) {
+    for (int c = 0; c < 256; c++) {
+        m.symbolOf[c] = isalpha(c) ? tolower(c) - 'a' + 1 : 0;
+    }
+    
+    // Trie, with -1 for missing edges
+    m.next.assign(KEYWORD_ROW, -1);
+    m.hits.assign(1, 0);
+    m.weights.clear();
+    m.categories.clear();
+    for (int k = 0; k < rules.rules.size(); k++) {
+        int state = 0;
+        for (char ch : rules.rules[k].keyword) {
+            int& edge = m.next[state * KEYWORD_ROW + m.symbolOf[(unsigned char)ch]];
+            if (edge < 0) {
+                edge = m.hits.size();
+                m.next.resize(m.next.size() + KEYWORD_ROW, -1);
+                m.hits.push_back(0);
+            }
+            state = m.next[state * KEYWORD_ROW + m.symbolOf[(unsigned char)ch]];
+        }
+        m.hits[state] |= 1ULL << k;
+        m.weights.push_back(rules.rules[k].weight);
+        m.categories.push_back(rules.rules[k].categories);
+    }
+    
+    m.keywords.clear();
+    memset(m.startingWith, 0, sizeof(m.startingWith));
+    m.prefixes.clear();
+    m.prefixFilter = true;
+    int letterIndex[3][KEYWORD_ALPHABET];
+    for (int pos = 0; pos < 3; pos++) {
+        m.letterCount[pos] = 0;
+        for (int c = 0; c < KEYWORD_ALPHABET; c++) letterIndex[pos][c] = -1;
+    }
+    for (int k = 0; k < rules.rules.size(); k++) {
+        const string& keyword = rules.rules[k].keyword;
+        m.keywords.push_back(keyword);
+        
+        array<int, 3> prefix = {-1, -1, -1};
+        for (int pos = 0; pos < 3 && pos < keyword.size(); pos++) {
+            int symbol = m.symbolOf[(unsigned char)keyword[pos]];
+            if (symbol == 0) continue;
+            if (letterIndex[pos][symbol] < 0) {
+                letterIndex[pos][symbol] = m.letterCount[pos];
+                memset(m.letterVectors[pos][m.letterCount[pos]++], 'a' + symbol - 1, KEYWORD_ROW);
+            }
+            prefix[pos] = letterIndex[pos][symbol];
+        }
+        if (prefix[0] < 0 || prefix[1] < 0) {
+            m.prefixFilter = false;
+            continue;
+        }
+        if (find(m.prefixes.begin(), m.prefixes.end(), prefix) == m.prefixes.end()) m.prefixes.push_back(prefix);
+        m.startingWith[m.symbolOf[(unsigned char)keyword[0]]][m.symbolOf[(unsigned char)keyword[1]]] |= 1ULL << k;
+    }
+    
+    // BFS turns missing edges into failure transitions; states come out in
+    // depth order, so a suffix's hits are final before they are inherited
+    vector<int> fail(m.hits.size(), 0);
+    queue<int> q;
+    for (int c = 0; c < KEYWORD_ALPHABET; c++) {
+        int& edge = m.next[c];
+        if (edge < 0) {
+            edge = 0;
+        } else {
+            q.push(edge);
+        }
+    }
+    while (!q.empty()) {
+        int state = q.front();
+        q.pop();
+        m.hits[state] |= m.hits[fail[state]];
+        for (int c = 0; c < KEYWORD_ALPHABET; c++) {
+            int& edge = m.next[state * KEYWORD_ROW + c];
+            int viaFail = m.next[fail[state] * KEYWORD_ROW + c];
+            if (edge < 0) {
+                edge = viaFail;
+            } else {
+                fail[edge] = viaFail;
+                q.push(edge);
+            }
+        }
+    }
+    
+    // Store row offsets rather than state numbers, so a step is add + load
+    for (int& target : m.next) {
+        target = max(target, 0) * KEYWORD_ROW;
+    }
+    m.built = true;
+}
+
+// Bit k set = keyword k occurs in text (case-insensitive);
+// walks the automaton one byte at a time
+unsigned long long scanKeywordsDFA(const KeywordMatcher& m, const string& text) {
+    const int* next = m.next.data();
+    const unsigned long long* hits = m.hits.data();
+    unsigned long long found = 0;
+    int row = 0;
+    for (unsigned char c : text) {
+        row = next[row + m.symbolOf[c]];
+        found |= hits[row >> KEYWORD_ROW_BITS];
+    }
+    return found;
+}
+
+// Keywords that occur starting at text[j], given a candidate leading pair
+unsigned long long keywordsAt(const KeywordMatcher& m, const char* text, int n, int j, unsigned long long candidates) {
+    unsigned long long found = 0;
+    for (; candidates; candidates &= candidates - 1) {
+        int k = lowestSetBit(candidates);
+        const string& keyword = m.keywords[k];
+        if (j + (int)keyword.size() > n) continue;
+        int t = 2;
+        while (t < keyword.size() && m.symbolOf[(unsigned char)text[j + t]] == m.symbolOf[(unsigned char)keyword[t]]) t++;
+        if (t == keyword.size()) found |= 1ULL << k;
+    }
+    return found;
+}
+
+// SIMD KEYWORD SCAN - Case-folded three-letter prefix prefilter
+// Compares a whole block of positions against every distinct keyword prefix
+// at once. OR 0x20 folds A-Z onto a-z (and makes no other byte equal a
+// lowercase letter), so folding and candidate search share one pass with no
+// copy of the text. Only the few candidate positions are verified byte by
+// byte. Blocks are 32 bytes with AVX2 (-mavx2), 16 with SSE2 (any x86-64),
+// and a scalar pair-table kernel stands in elsewhere.
+// Time Complexity: O(n * prefixes / block width + candidates * keyword length)
+// Space Complexity: O(1)
+#if defined(__AVX2__)
+const int KEYWORD_BLOCK = 32;
+
+// Bit j set = some keyword prefix may start at p[j]; reads p[0 .. 33]
+inline unsigned prefixCandidates(const KeywordMatcher& m, const char* p) {
+    const __m256i caseBit = _mm256_set1_epi8(0x20);
+    __m256i a = _mm256_or_si256(_mm256_loadu_si256((const __m256i*)p), caseBit);
+    __m256i b = _mm256_or_si256(_mm256_loadu_si256((const __m256i*)(p + 1)), caseBit);
+    __m256i c = _mm256_or_si256(_mm256_loadu_si256((const __m256i*)(p + 2)), caseBit);
+    __m256i hit = _mm256_setzero_si256();
+    for (const array<int, 3>& k : m.prefixes) {
+        __m256i both = _mm256_and_si256(_mm256_cmpeq_epi8(a, _mm256_load_si256((const __m256i*)m.letterVectors[0][k[0]])), 
+                                        _mm256_cmpeq_epi8(b, _mm256_load_si256((const __m256i*)m.letterVectors[1][k[1]])));
+        hit = _mm256_or_si256(hit, k[2] < 0 ? both : _mm256_and_si256(both, _mm256_cmpeq_epi8(c, _mm256_load_si256((const __m256i*)m.letterVectors[2][k[2]]))));
+    }
+    return _mm256_movemask_epi8(hit);
+}
+#elif defined(__SSE2__) || defined(_M_X64)
+const int KEYWORD_BLOCK = 16;
+
+// Bit j set = some keyword prefix may start at p[j]; reads p[0 .. 17]
+inline unsigned prefixCandidates(const KeywordMatcher& m, const char* p) {
+    const __m128i caseBit = _mm_set1_epi8(0x20);
+    __m128i a = _mm_or_si128(_mm_loadu_si128((const __m128i*)p), caseBit);
+    __m128i b = _mm_or_si128(_mm_loadu_si128((const __m128i*)(p + 1)), caseBit);
+    __m128i c = _mm_or_si128(_mm_loadu_si128((const __m128i*)(p + 2)), caseBit);
+    __m128i hit = _mm_setzero_si128();
+    for (const array<int, 3>& k : m.prefixes) {
+        __m128i both = _mm_and_si128(_mm_cmpeq_epi8(a, _mm_load_si128((const __m128i*)m.letterVectors[0][k[0]])), 
+                                     _mm_cmpeq_epi8(b, _mm_load_si128((const __m128i*)m.letterVectors[1][k[1]])));
+        hit = _mm_or_si128(hit, k[2] < 0 ? both : _mm_and_si128(both, _mm_cmpeq_epi8(c, _mm_load_si128((const __m128i*)m.letterVectors[2][k[2]]))));
+    }
+    return _mm_movemask_epi8(hit);
+}
+#else
+const int KEYWORD_BLOCK = 16;
+
+// Bit j set = some keyword may start at p[j] (first two letters); reads p[0 .. 16]
+inline unsigned prefixCandidates(const KeywordMatcher& m, const char* p) {
+    unsigned mask = 0;
+    for (int j = 0; j < KEYWORD_BLOCK; j++) {
+        if (m.startingWith[m.symbolOf[(unsigned char)p[j]]][m.symbolOf[(unsigned char)p[j + 1]]]) mask |= 1u << j;
+    }
+    return mask;
+}
+#endif
+
+// Text length from which the prefilter beats the automaton (measured with
+// the benchmark; the scalar kernel never does)
+#if defined(__AVX2__)
+const int KEYWORD_SIMD_MIN_BYTES = 256;
+#elif defined(__SSE2__) || defined(_M_X64)
+const int KEYWORD_SIMD_MIN_BYTES = 1024;
+#else
+const int KEYWORD_SIMD_MIN_BYTES = INT_MAX;
+#endif
+
+const char* keywordScanKernel() {
+#if defined(__AVX2__)
+    return "AVX2";
+#elif defined(__SSE2__) || defined(_M_X64)
+    return "SSE2";
+#else
+    return "Scalar";
+#endif
+}
+
+unsigned long long scanKeywordsSIMD(const KeywordMatcher& m, const string& text) {
+    int n = text.size();
+    unsigned long long found = 0;
+    char tail[KEYWORD_BLOCK + 2];
+    
+    for (int i = 0; i + 1 < n; i += KEYWORD_BLOCK) {
+        const char* block = text.data() + i;
+        int left = n - i;
+        if (left < KEYWORD_BLOCK + 2) {
+            // The last block would read past the end: run it on a zero-padded copy
+            memset(tail, 0, sizeof(tail));
+            memcpy(tail, block, left);
+            block = tail;
+        }
+        for (unsigned mask = prefixCandidates(m, block); mask; mask &= mask - 1) {
+            int j = lowestSetBit(mask);
+            unsigned long long c = m.startingWith[m.symbolOf[(unsigned char)block[j]]][m.symbolOf[(unsigned char)block[j + 1]]] & ~found;
+            if (c) found |= keywordsAt(m, block, left, j, c);
+        }
+    }
+    return found;
+}
+
+// The matcher for the rules in force, built from the defaults on first use
+KeywordMatcher& activeComplaintMatcher() {
+    if (!complaintMatcher.built) {
+        if (complaintRules.rules.empty()) complaintRules = defaultComplaintRules();
+        buildKeywordMatcher(complaintMatcher, complaintRules);
+    }
+    return complaintMatcher;
+}
+
+// Bit k set = keyword k of the active rules occurs in text (case-insensitive)
+unsigned long long findComplaintKeywords(const string& text) {
+    const KeywordMatcher& m = activeComplaintMatcher();
+    if (m.prefixFilter && text.size() >= KEYWORD_SIMD_MIN_BYTES) return scanKeywordsSIMD(m, text);
+    return scanKeywordsDFA(m, text);
+}
+
+// Bulk scan throughput of the keyword paths, first over `count` short
+// synthetic complaints, then over long case notes of the same total size
+void benchmarkKeywordScan(int count) {
+    printSubHeader("Complaint Scan Benchmark (MB/s)");
+    
+    const KeywordMatcher& m = activeComplaintMatcher();
+    
+    const char* words[] = {"need", "a", "place", "to", "stay", "tonight", "the", "weather", "is", "cold", "and", 
+                           "I", "have", "not", "eaten", "since", "yesterday", "my", "back", "hurts", "there", 
+                           "are", "people", "near", "station", "lost", "job", "please", "help", "with", "family", 
+                           "Medical", "URGENT", "child", "food", "danger", "Shelter", "doctor", "threat", "sleep"};
+    const int wordCount = sizeof(words) / sizeof(words[0]);
+    mt19937 rng(19);
+    string prefilterName = string(keywordScanKernel()) + " prefix prefilter";
+    const char* names[4] = {"Lowercase copy + Rabin-Karp", "Aho-Corasick automaton", prefilterName.c_str(), 
+                            "Dispatch (as used)"};
+    
+    for (int corpus = 0; corpus < 2; corpus++) {
+        // Short complaints of 4-31 words, or ~3 KB notes of 400-500 words
+        int texts = corpus == 0 ? count : max(1, count / 30);
+        vector<string> complaints(texts);
+        size_t bytes = 0;
+        for (string& c : complaints) {
+            int length = corpus == 0 ? 4 + rng() % 28 : 400 + rng() % 100;
+            for (int w = 0; w < length; w++) {
+                // Keywords (the last 9 words) are rarer than filler
+                int pick = rng() % 8 == 0 ? wordCount - 1 - rng() % 9 : rng() % (wordCount - 9);
+                if (w) c += ' ';
+                c += words[pick];
+            }
+            bytes += c.size();
+        }
+        
+        double ms[4];
+        unsigned long long checksum[4] = {0, 0, 0, 0};
+        for (int variant = 0; variant < 4; variant++) {
+            auto start = chrono::steady_clock::now();
+            for (const string& c : complaints) {
+                unsigned long long found = 0;
+                if (variant == 0) {
+                    string lower = c;
+                    transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+                    for (int k = 0; k < m.keywords.size(); k++) {
+                        if (rabinKarpSearch(lower, m.keywords[k])) found |= 1ULL << k;
+                    }
+                } else if (variant == 1) {
+                    found = scanKeywordsDFA(m, c);
+                } else if (variant == 2) {
+                    found = m.prefixFilter ? scanKeywordsSIMD(m, c) : scanKeywordsDFA(m, c);
+                } else {
+                    found = findComplaintKeywords(c);
+                }
+                checksum[variant] = checksum[variant] * 31 + found;
+            }
+            ms[variant] = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        }
+        
+        cout << (corpus == 0 ? "Short complaints: " : "\nLong case notes: ") << texts << " texts, " 
+             << fixed << setprecision(1) << bytes / 1e6 << " MB, " << m.keywords.size() << " keywords\n";
+        cout << left << setw(32) << "Path" << setw(12) << "Time (ms)" << setw(12) << "MB/s" << "\n";
+        cout << string(56, '-') << "\n";
+        for (int variant = 0; variant < 4; variant++) {
+            cout << left << setw(32) << names[variant] << setw(12) << ms[variant] 
+                 << setw(12) << (ms[variant] > 0 ? bytes / 1e3 / ms[variant] : 0) << "\n";
+        }
+        
+        if (checksum[0] == checksum[1] && checksum[1] == checksum[2] && checksum[2] == checksum[3]) {
+            printSuccess("All paths found the same keywords");
+        } else {
+            printError("Keyword results differ!");
+        }
+    }
+    cout << "\nDispatch uses the prefilter for texts of " << KEYWORD_SIMD_MIN_BYTES << "+ bytes.\n";
+}
+
+ComplaintMatch matchComplaint(const string& text) {
+    ComplaintMatch result = {0, 0};
+    unsigned long long found = findComplaintKeywords(text);
+    const KeywordMatcher& m = complaintMatcher;
+    for (int k = 0; found; k++, found >>= 1) {
+        if (found & 1) {
+            result.priority += m.weights[k];
+            result.categories |= m.categories[k];
+        }
+    }
+    return result;
+}
+
+// COMPLAINT RULES FILE - keyword weights and categories without a rebuild
+// One rule per line, '#' starts a comment:
+//   <keyword> <weight> [category ...]
+//   categories <name ...>      (optional: the order classifications list them in)
+// Keywords are letters only and match in any case. Categories not declared
+// are added in order of first use. Rules are compiled into the same automaton
+// as the built-in table, so a loaded rule set scans exactly as fast.
+// Time Complexity: O(lines + rules^2) to parse (duplicate check, rules <= 64)
+// Space Complexity: O(rules)
+const string COMPLAINT_RULES_FILE = "complaint_rules.txt";
+
+// Bit index of a category, added if new; -1 once there are too many
+int complaintCategoryBit(ComplaintRules& rules, const string& name) {
+    for (int c = 0; c < rules.categoryNames.size(); c++) {
+        if (rules.categoryNames[c] == name) return c;
+    }
+    if (rules.categoryNames.size() == MAX_COMPLAINT_CATEGORIES) return -1;
+    rules.categoryNames.push_back(name);
+    return rules.categoryNames.size() - 1;
+}
+
+// Reads a rules file into `out`. On failure `error` says why (with the line
+// number for a bad line) and `out` is not meant to be used.
+bool loadComplaintRules(const string& path, ComplaintRules& out, string& error) {
+    ifstream file(path);
+    if (!file) {
+        error = "cannot open " + path;
+        return false;
+    }
+    
+    out = ComplaintRules();
+    string line;
+    int lineNumber = 0;
+    while (getline(file, line)) {
+        lineNumber++;
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        istringstream in(line);
+        string word, category;
+        if (!(in >> word) || word[0] == '#') continue;
+        string where = "line " + to_string(lineNumber) + ": ";
+        
+        if (word == "categories") {
+            while (in >> category && category[0] != '#') {
+                if (complaintCategoryBit(out, category) < 0) {
+                    error = where + "more than " + to_string(MAX_COMPLAINT_CATEGORIES) + " categories";
+                    return false;
+                }
+            }
+            continue;
+        }
+        
+        KeywordRule rule = {"", 0, 0};
+        for (char c : word) {
+            if (!isalpha((unsigned char)c)) {
+                error = where + "keyword '" + word + "' must be letters only";
+                return false;
+            }
+            rule.keyword += tolower(c);
+        }
+        if (!(in >> rule.weight) || rule.weight < 0) {
+            error = where + "expected a non-negative weight after '" + word + "'";
+            return false;
+        }
+        while (in >> category && category[0] != '#') {
+            int bit = complaintCategoryBit(out, category);
+            if (bit < 0) {
+                error = where + "more than " + to_string(MAX_COMPLAINT_CATEGORIES) + " categories";
+                return false;
+            }
+            rule.categories |= 1 << bit;
+        }
+        for (const KeywordRule& r : out.rules) {
+            if (r.keyword == rule.keyword) {
+                error = where + "'" + rule.keyword + "' is already defined";
+                return false;
+            }
+        }
+        if (out.rules.size() == MAX_COMPLAINT_KEYWORDS) {
+            error = where + "more than " + to_string(MAX_COMPLAINT_KEYWORDS) + " keywords";
+            return false;
+        }
+        out.rules.push_back(rule);
+    }
+    
+    if (out.rules.empty()) {
+        error = path + " has no keyword rules";
+        return false;
+    }
+    return true;
+}
+
+// Writes `rules` in the format loadComplaintRules reads
+bool saveComplaintRules(const string& path, const ComplaintRules& rules) {
+    ofstream file(path);
+    if (!file) return false;
+    
+    file << "# Complaint keyword rules: <keyword> <weight> [category ...]\n";
+    file << "categories";
+    for (const string& name : rules.categoryNames) file << " " << name;
+    file << "\n";
+    for (const KeywordRule& r : rules.rules) {
+        file << r.keyword << " " << r.weight;
+        for (int c = 0; c < rules.categoryNames.size(); c++) {
+            if (r.categories & (1 << c)) file << " " << rules.categoryNames[c];
+        }
+        file << "\n";
+    }
+    return bool(file);
+}
+
+// Compiles `rules` into a new automaton and only then replaces the active
+// one, so matching never sees a half-built matcher
+void applyComplaintRules(const ComplaintRules& rules) {
+    KeywordMatcher m;
+    buildKeywordMatcher(m, rules);
+    complaintRules = rules;
+    complaintMatcher = move(m);
+}
+
+// 🔟 PRIORITY CALCULATION with detailed scoring
+// Time Complexity: O(1)
+int calculatePriority(Homeless& h) {
+    int priority = 0;
+    
+    // Age-based priority
+    if (h.age < 12) priority += 50; // Child
+    else if (h.age > 65) priority += 40; // Elderly
+    else if (h.age > 55) priority += 20; // Senior
+    
+    // Gender-based priority
+    if (h.gender == "Female" || h.gender == "female") priority += 30;
+    
+    // Medical emergency
+    if (h.medicalNeed) priority += 60;
+    
+    // Complaint keywords, all found in one Aho-Corasick pass
+    priority += matchComplaint(h.complaint).priority;
+    
+    h.priorityScore = priority;
+    return priority;
+}
+
+// SHELTER REGISTRY - Hash map for IDs, max segment tree for free beds
+// A shelter's position in `shelters` is its handle: the vector is only ever
+// replaced wholesale, never reordered. Each leaf of the tree holds one
+// shelter's free beds and each inner node the maximum below it, so "most free
+// shelter" is a walk from the root and "at least N beds" only enters subtrees
+// whose maximum reaches N.
+// Time Complexity: O(1) lookup, O(log S) update and most-free query,
+//                  O(k log S) to list k shelters with enough beds
+// Space Complexity: O(S)
+void buildShelterRegistry() {
+    ShelterRegistry& r = shelterRegistry;
+    r.handleOf.clear();
+    r.leaves = 1;
+    while (r.leaves < shelters.size()) r.leaves *= 2;
+    r.maxFreeBeds.assign(2 * r.leaves, -1);   // -1 marks an empty leaf
+    r.bedsLeft.reset(new atomic<int>[shelters.size()]);
+    
+    for (int i = 0; i < shelters.size(); i++) {
+        r.handleOf[shelters[i].id] = i;
+        r.maxFreeBeds[r.leaves + i] = freeBeds(shelters[i]);
+        r.bedsLeft[i].store(freeBeds(shelters[i]));
+    }
+    for (int i = r.leaves - 1; i >= 1; i--) {
+        r.maxFreeBeds[i] = max(r.maxFreeBeds[2 * i], r.maxFreeBeds[2 * i + 1]);
+    }
+    shelterRegistryValid = true;
+}
+
+const ShelterRegistry& registry() {
+    if (!shelterRegistryValid) buildShelterRegistry();
+    return shelterRegistry;
+}
+
+// Call after `shelters` is replaced or appended to
+void onSheltersReplaced() {
+    shelterRegistryValid = false;
+    catchmentValid = false;
+}
+
+int shelterHandle(int shelterID) {
+    const ShelterRegistry& r = registry();
+    auto it = r.handleOf.find(shelterID);
+    return it == r.handleOf.end() ? -1 : it->second;
+}
+
+Shelter* findShelter(int shelterID) {
+    int handle = shelterHandle(shelterID);
+    return handle == -1 ? nullptr : &shelters[handle];
+}
+
+// BED CLAIMS - Atomic compare-and-decrement on each shelter's free-bed counter
+// Allocation, holds, batch plans and concurrent intake all take a bed from
+// the registry's counter before touching the shelter record, and give it
+// back there when a bed is freed. A claim only succeeds while enough beds
+// are left, so callers on different threads can never over-allocate.
+// Time Complexity: O(1) expected per claim
+// Space Complexity: O(S) for the counters
+bool reserveBed(atomic<int>& freeBedsLeft, int beds = 1) {
+    int current = freeBedsLeft.load(memory_order_relaxed);
+    while (current >= beds) {
+        if (freeBedsLeft.compare_exchange_weak(current, current - beds, memory_order_acq_rel)) return true;
+    }
+    return false;
+}
+
+atomic<int>& bedCounter(int handle) {
+    return registry().bedsLeft[handle];
+}
+
+// Beds not yet claimed, as of now
+int bedsLeft(int handle) {
+    return bedCounter(handle).load(memory_order_acquire);
+}
+
+bool claimBeds(int shelterID, int beds = 1) {
+    int handle = shelterHandle(shelterID);
+    return handle != -1 && reserveBed(bedCounter(handle), beds);
+}
+
+void returnBeds(int shelterID, int beds = 1) {
+    int handle = shelterHandle(shelterID);
+    if (handle != -1) bedCounter(handle).fetch_add(beds, memory_order_acq_rel);
+}
+
+void updateFreeBedIndex(int handle) {
+    if (!shelterRegistryValid) return;
+    ShelterRegistry& r = shelterRegistry;
+    int i = r.leaves + handle;
+    r.maxFreeBeds[i] = freeBeds(shelters[handle]);
+    for (i /= 2; i >= 1; i /= 2) {
+        r.maxFreeBeds[i] = max(r.maxFreeBeds[2 * i], r.maxFreeBeds[2 * i + 1]);
+    }
+}
+
+// Handle of the shelter with the most free beds (lowest handle on ties), or -1
+int mostFreeShelter() {
+    const ShelterRegistry& r = registry();
+    if (r.maxFreeBeds[1] <= 0) return -1;
+    
+    int i = 1;
+    while (i < r.leaves) {
+        i = (r.maxFreeBeds[2 * i] == r.maxFreeBeds[i]) ? 2 * i : 2 * i + 1;
+    }
+    return i - r.leaves;
+}
+
+void collectFreeShelters(int i, int minBeds, vector<int>& handles) {
+    const ShelterRegistry& r = shelterRegistry;
+    if (r.maxFreeBeds[i] < minBeds) return;
+    if (i >= r.leaves) {
+        handles.push_back(i - r.leaves);
+        return;
+    }
+    collectFreeShelters(2 * i, minBeds, handles);
+    collectFreeShelters(2 * i + 1, minBeds, handles);
+}
+
+// Handles of every shelter with at least minBeds free beds, in handle order
+vector<int> sheltersWithFreeBeds(int minBeds) {
+    vector<int> handles;
+    registry();
+    collectFreeShelters(1, max(minBeds, 1), handles);
+    return handles;
+}
+
+// 9️⃣ SHELTER CATCHMENT TABLE - Multi-source K-nearest Dijkstra
+// Every node keeps its CATCHMENT_K nearest shelters with free beds, ranked by
+// distance. Roads are two-way, so spreading out from the shelters gives the
+// same distances a person would travel to reach them.
+// Time Complexity: O(K (V+E) log(KV)) to build, O(1) lookup, repairs touch only
+//                  the nodes whose ranking actually changes
+// Space Complexity: O(K V)
+typedef tuple<int, int, int, int> CatchmentLabel; // (distance, shelterID, node, via)
+typedef priority_queue<CatchmentLabel, vector<CatchmentLabel>, greater<CatchmentLabel>> CatchmentQueue;
+
+const CatchmentEntry* catchmentFind(const vector<CatchmentEntry>& ranked, int shelterID) {
+    for (const CatchmentEntry& c : ranked) {
+        if (c.shelterID == shelterID) return &c;
+    }
+    return nullptr;
+}
+
+bool catchmentContains(const vector<CatchmentEntry>& ranked, int shelterID) {
+    return catchmentFind(ranked, shelterID) != nullptr;
+}
+
+// Labels leave the queue in (distance, shelterID) order, so each node's list
+// is filled already ranked and a node stops spreading once it holds K labels.
+void spreadCatchment(CatchmentQueue& pq, const vector<bool>& inRegion) {
+    while (!pq.empty()) {
+        int d = get<0>(pq.top());
+        int shelterID = get<1>(pq.top());
+        int u = get<2>(pq.top());
+        int via = get<3>(pq.top());
+        pq.pop();
+        
+        vector<CatchmentEntry>& ranked = shelterCatchment[u];
+        if (ranked.size() >= CATCHMENT_K || catchmentContains(ranked, shelterID)) continue;
+        ranked.push_back({shelterID, d, via});
+        
+        for (const Edge& e : roadNetwork().neighbors(u)) {
+            if (inRegion[e.dest] && shelterCatchment[e.dest].size() < CATCHMENT_K) {
+                pq.push(make_tuple(d + e.weight, shelterID, e.dest, u));
+            }
+        }
+    }
+}
+
+// Labels that got cheaper push their way into every list they now make the
+// top K of, replacing older, longer labels for the same shelter.
+void improveCatchment(CatchmentQueue& pq) {
+    while (!pq.empty()) {
+        int d = get<0>(pq.top());
+        int shelterID = get<1>(pq.top());
+        int u = get<2>(pq.top());
+        int via = get<3>(pq.top());
+        pq.pop();
+        
+        vector<CatchmentEntry>& ranked = shelterCatchment[u];
+        const CatchmentEntry* existing = catchmentFind(ranked, shelterID);
+        if (existing) {
+            if (existing->distance <= d) continue;
+            ranked.erase(ranked.begin() + (existing - ranked.data()));
+        }
+        
+        auto pos = ranked.begin();
+        while (pos != ranked.end() && 
+               (pos->distance < d || (pos->distance == d && pos->shelterID < shelterID))) {
+            ++pos;
+        }
+        if (pos - ranked.begin() >= CATCHMENT_K) continue;
+        
+        ranked.insert(pos, {shelterID, d, via});
+        if (ranked.size() > CATCHMENT_K) ranked.pop_back();
+        
+        for (const Edge& e : roadNetwork().neighbors(u)) {
+            pq.push(make_tuple(d + e.weight, shelterID, e.dest, u));
+        }
+    }
+}
+
+void buildShelterCatchment() {
+    shelterCatchment.assign(nodeCount, vector<CatchmentEntry>());
+    catchmentOpen.clear();
+    
+    CatchmentQueue pq;
+    for (const Shelter& s : shelters) {
+        catchmentOpen[s.id] = hasFreeBeds(s);
+        if (catchmentOpen[s.id]) {
+            pq.push(make_tuple(0, s.id, s.nodeID, -1));
+        }
+    }
+    
+    spreadCatchment(pq, vector<bool>(nodeCount, true));
+    catchmentValid = true;
+}
+
+// Clears and re-ranks a region from the still-valid lists on its border plus
+// any open shelters inside it. Every shortest path from inside the region
+// either ends at one of those shelters or leaves through a border node that
+// already ranks its destination, so nothing outside needs to be revisited.
+void rerankCatchmentRegion(const vector<int>& region, const vector<bool>& inRegion) {
+    for (int u : region) {
+        shelterCatchment[u].clear();
+    }
+    
+    CatchmentQueue pq;
+    for (int u : region) {
+        for (const Edge& e : roadNetwork().neighbors(u)) {
+            if (inRegion[e.dest]) continue;
+            for (const CatchmentEntry& c : shelterCatchment[e.dest]) {
+                pq.push(make_tuple(c.distance + e.weight, c.shelterID, u, e.dest));
+            }
+        }
+    }
+    for (const Shelter& s : shelters) {
+        if (catchmentOpen[s.id] && inRegion[s.nodeID]) {
+            pq.push(make_tuple(0, s.id, s.nodeID, -1));
+        }
+    }
+    
+    spreadCatchment(pq, inRegion);
+}
+
+// A full shelter drops out of every list that ranked it. Those nodes form a
+// connected region around the shelter, which is re-ranked.
+void closeShelterInCatchment(const Shelter& closed) {
+    vector<bool> affected(nodeCount, false);
+    vector<int> region;
+    
+    if (catchmentContains(shelterCatchment[closed.nodeID], closed.id)) {
+        queue<int> q;
+        q.push(closed.nodeID);
+        affected[closed.nodeID] = true;
+        while (!q.empty()) {
+            int u = q.front();
+            q.pop();
+            region.push_back(u);
+            for (const Edge& e : roadNetwork().neighbors(u)) {
+                if (!affected[e.dest] && catchmentContains(shelterCatchment[e.dest], closed.id)) {
+                    affected[e.dest] = true;
+                    q.push(e.dest);
+                }
+            }
+        }
+    }
+    
+    rerankCatchmentRegion(region, affected);
+}
+
+// A shelter that frees up a bed pushes its way into the lists of every node
+// it now outranks, stopping wherever it would not make the top K.
+void openShelterInCatchment(const Shelter& opened) {
+    CatchmentQueue pq;
+    pq.push(make_tuple(0, opened.id, opened.nodeID, -1));
+    improveCatchment(pq);
+}
+
+// Called through onShelterChanged()
+void catchmentOnShelterChanged(int shelterID) {
+    if (!catchmentValid) return;
+    
+    Shelter* s = findShelter(shelterID);
+    if (!s) {
+        catchmentValid = false;
+        return;
+    }
+    
+    bool open = hasFreeBeds(*s);
+    if (catchmentOpen[shelterID] == open) return;
+    catchmentOpen[shelterID] = open;
+    
+    if (open) openShelterInCatchment(*s);
+    else closeShelterInCatchment(*s);
+}
+
+// A road u - v got cheaper (or was opened): labels at either end may now
+// reach further through it.
+void catchmentOnRoadShortened(int u, int v, int weight) {
+    if (!catchmentValid) return;
+    
+    CatchmentQueue pq;
+    for (const CatchmentEntry& c : shelterCatchment[u]) {
+        pq.push(make_tuple(c.distance + weight, c.shelterID, v, u));
+    }
+    for (const CatchmentEntry& c : shelterCatchment[v]) {
+        pq.push(make_tuple(c.distance + weight, c.shelterID, u, v));
+    }
+    improveCatchment(pq);
+}
+
+// A road u - v got longer (or was closed): every label whose path ran over
+// it sits in a tree hanging off u or v, found by following `via` links.
+// Returns the number of nodes re-ranked.
+int catchmentOnRoadLengthened(int u, int v) {
+    if (!catchmentValid) return 0;
+    
+    vector<bool> affected(nodeCount, false);
+    vector<int> region;
+    queue<pair<int, int>> q; // (node, shelterID) labels known to be stale
+    
+    for (const CatchmentEntry& c : shelterCatchment[v]) {
+        if (c.via == u) q.push({v, c.shelterID});
+    }
+    for (const CatchmentEntry& c : shelterCatchment[u]) {
+        if (c.via == v) q.push({u, c.shelterID});
+    }
+    
+    unordered_map<long long, bool> seen; // (node << 32 | shelterID) already queued
+    while (!q.empty()) {
+        int x = q.front().first;
+        int shelterID = q.front().second;
+        q.pop();
+        
+        long long key = ((long long)x << 32) | (unsigned)shelterID;
+        if (seen[key]) continue;
+        seen[key] = true;
+        
+        if (!affected[x]) {
+            affected[x] = true;
+            region.push_back(x);
+        }
+        
+        for (const Edge& e : roadNetwork().neighbors(x)) {
+            const CatchmentEntry* c = catchmentFind(shelterCatchment[e.dest], shelterID);
+            if (c && c->via == x) q.push({e.dest, shelterID});
+        }
+    }
+    
+    rerankCatchmentRegion(region, affected);
+    return region.size();
+}
+
+const vector<CatchmentEntry>& rankedSheltersNear(int node) {
+    if (!catchmentValid) buildShelterCatchment();
+    return shelterCatchment[node];
+}
+
+// Call after any change to a shelter's occupancy or total capacity
+void onShelterChanged(int shelterID) {
+    int handle = shelterHandle(shelterID);
+    if (handle != -1) updateFreeBedIndex(handle);
+    catchmentOnShelterChanged(shelterID);
+}
+
+// K-NEAREST AVAILABLE SHELTERS - Early-terminating Dijkstra
+// Grows the search outward from one node and stops as soon as k shelters with
+// free beds have been settled. Distances live in a hash map, so a query that
+// ends a few blocks away never touches the rest of the city.
+// Time Complexity: O(S + (V'+E') log V') where V', E' are the nodes and roads settled
+// Space Complexity: O(V')
+NearestShelterResult nearestAvailableShelters(int source, int k) {
+    NearestShelterResult result;
+    result.nodesSettled = 0;
+    
+    unordered_map<int, vector<int>> openAtNode;
+    int openCount = 0;
+    for (int handle : sheltersWithFreeBeds(1)) {
+        openAtNode[shelters[handle].nodeID].push_back(shelters[handle].id);
+        openCount++;
+    }
+    k = min(k, openCount);
+    if (k <= 0) return result;
+    
+    const CSRGraph& g = roadNetwork();
+    unordered_map<int, int> dist;
+    unordered_map<int, bool> settled;
+    priority_queue<pair<int, int>, vector<pair<int, int>>, greater<pair<int, int>>> pq;
+    
+    dist[source] = 0;
+    pq.push({0, source});
+    
+    while (!pq.empty() && result.shelters.size() < k) {
+        int d = pq.top().first;
+        int u = pq.top().second;
+        pq.pop();
+        
+        if (settled[u]) continue;
+        settled[u] = true;
+        result.nodesSettled++;
+        
+        auto here = openAtNode.find(u);
+        if (here != openAtNode.end()) {
+            for (int shelterID : here->second) {
+                if (result.shelters.size() < k) result.shelters.push_back({shelterID, d, -1});
+            }
+        }
+        
+        for (const Edge& e : g.neighbors(u)) {
+            auto it = dist.find(e.dest);
+            if (it == dist.end() || d + e.weight < it->second) {
+                dist[e.dest] = d + e.weight;
+                pq.push({d + e.weight, e.dest});
+            }
+        }
+    }
+    
+    return result;
+}
+
+// BATCH ALLOCATION - Priority-weighted min-cost flow
+// All waiting persons and all free beds are solved together as a flow from
+// persons through shelters (one unit per bed) to a sink. Moving a person costs
+// road distance x (100 + priority), so an urgent case's travel counts for
+// more. Persons join in priority order and each is placed along the cheapest
+// augmenting path, which may shift already-placed persons to other shelters;
+// a lower-priority person can therefore never take the last reachable bed from
+// a higher one, and the plan stays minimum-cost for everyone placed so far.
+// Node potentials keep reduced costs non-negative so each path is a Dijkstra
+// that stops at the sink. Each person only considers their BATCH_CANDIDATES
+// nearest open shelters, which bounds the network size.
+// Time Complexity: O(min(S, L) (V+E) log V) for candidates at L locations,
+//                  then O(P A log A) worst case, where A is the part of the
+//                  flow network one search reaches
+// Space Complexity: O(P k + S)
+const int BATCH_CANDIDATES = 16;
+
+struct BatchPerson {
+    int homelessID;
+    int priority;
+    vector<CatchmentEntry> options;   // nearest open shelters first
+};
+
+struct BatchPlan {
+    vector<int> shelterOf;            // per BatchPerson, shelter ID or -1
+    int placed;
+    long long totalDistance;
+    long long weightedDistance;
+    double ms;
+};
+
+// Records one placement of a bed already claimed with claimBeds(); the
+// caller holds shelterWrites and refreshes the catchment afterwards
+void assignToShelter(Homeless* h, Shelter* s) {
+    s->capacityOccupied++;
+    s->allocatedPersonIDs.push_back(h->id);
+    h->allocated = true;
+    h->allocatedShelterID = s->id;
+    onPersonChanged(h->id);
+}
+
+// Frees the person's bed, if they have one
+void releaseFromShelter(Homeless* h) {
+    lock_guard<recursive_mutex> lock(shelterWrites);
+    if (!h->allocated) return;
+    Shelter* s = findShelter(h->allocatedShelterID);
+    if (s) {
+        s->capacityOccupied--;
+        auto it = find(s->allocatedPersonIDs.begin(), s->allocatedPersonIDs.end(), h->id);
+        if (it != s->allocatedPersonIDs.end()) s->allocatedPersonIDs.erase(it);
+        returnBeds(s->id);
+    }
+    h->allocated = false;
+    h->allocatedShelterID = -1;
+    onPersonChanged(h->id);
+    if (s) onShelterChanged(s->id);
+}
+
+long long batchCost(const BatchPerson& p, int distance) {
+    return (long long)distance * (100 + p.priority);
+}
+
+// Unallocated persons, highest priority first, with their candidate shelters
+vector<BatchPerson> collectBatchPersons() {
+    vector<BatchPerson> persons;
+    for (int handle : unallocatedPersons()) {
+        const Homeless& h = personAt(handle);
+        persons.push_back({h.id, h.priorityScore, {}});
+    }
+    sort(persons.begin(), persons.end(), [](const BatchPerson& a, const BatchPerson& b) {
+        return a.priority != b.priority ? a.priority > b.priority : a.homelessID < b.homelessID;
+    });
+    
+    unordered_map<int, vector<CatchmentEntry>> optionsAtNode;
+    for (const BatchPerson& p : persons) {
+        optionsAtNode[searchHomeless(p.homelessID)->locationNodeID];
+    }
+    
+    unordered_map<int, vector<int>> openAtNode;
+    for (int handle : sheltersWithFreeBeds(1)) {
+        openAtNode[shelters[handle].nodeID].push_back(shelters[handle].id);
+    }
+    auto nearerFirst = [](const CatchmentEntry& a, const CatchmentEntry& b) { return a.distance < b.distance; };
+    
+    if (openAtNode.size() <= optionsAtNode.size()) {
+        // Fewer shelter sites than locations: one full search per site (roads
+        // are two-way, so its distances are also the distances to it)
+        for (const auto& site : openAtNode) {
+            vector<int> dist = dijkstra(site.first);
+            for (auto& entry : optionsAtNode) {
+                vector<CatchmentEntry>& options = entry.second;
+                int d = dist[entry.first];
+                if (d == INT_MAX) continue;
+                for (int shelterID : site.second) options.push_back({shelterID, d, -1});
+                if (options.size() >= 2 * BATCH_CANDIDATES) {
+                    nth_element(options.begin(), options.begin() + BATCH_CANDIDATES, options.end(), nearerFirst);
+                    options.resize(BATCH_CANDIDATES);
+                }
+            }
+        }
+        for (auto& entry : optionsAtNode) {
+            vector<CatchmentEntry>& options = entry.second;
+            sort(options.begin(), options.end(), nearerFirst);
+            if (options.size() > BATCH_CANDIDATES) options.resize(BATCH_CANDIDATES);
+        }
+    } else {
+        for (auto& entry : optionsAtNode) {
+            entry.second = nearestAvailableShelters(entry.first, BATCH_CANDIDATES).shelters;
+        }
+    }
+    
+    for (BatchPerson& p : persons) {
+        p.options = optionsAtNode[searchHomeless(p.homelessID)->locationNodeID];
+    }
+    return persons;
+}
+
+// Free beds per shelter handle
+vector<int> freeBedsByHandle() {
+    vector<int> beds(shelters.size());
+    for (int i = 0; i < shelters.size(); i++) beds[i] = freeBeds(shelters[i]);
+    return beds;
+}
+
+void totalPlanDistance(const vector<BatchPerson>& persons, BatchPlan& plan) {
+    plan.placed = 0;
+    plan.totalDistance = 0;
+    plan.weightedDistance = 0;
+    for (int p = 0; p < persons.size(); p++) {
+        const CatchmentEntry* c = catchmentFind(persons[p].options, plan.shelterOf[p]);
+        if (!c) continue;
+        plan.placed++;
+        plan.totalDistance += c->distance;
+        plan.weightedDistance += batchCost(persons[p], c->distance);
+    }
+}
+
+// What allocating one person at a time would do: nearest candidate with a bed
+BatchPlan greedyBatchPlan(const vector<BatchPerson>& persons) {
+    auto start = chrono::steady_clock::now();
+    vector<int> beds = freeBedsByHandle();
+    
+    BatchPlan plan;
+    plan.shelterOf.assign(persons.size(), -1);
+    for (int p = 0; p < persons.size(); p++) {
+        for (const CatchmentEntry& c : persons[p].options) {
+            int s = shelterHandle(c.shelterID);
+            if (beds[s] > 0) {
+                beds[s]--;
+                plan.shelterOf[p] = c.shelterID;
+                break;
+            }
+        }
+    }
+    
+    totalPlanDistance(persons, plan);
+    plan.ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    return plan;
+}
+
+BatchPlan minCostBatchPlan(const vector<BatchPerson>& persons) {
+    auto start = chrono::steady_clock::now();
+    vector<int> beds = freeBedsByHandle();
+    int P = persons.size(), S = shelters.size();
+    int sink = P + S;                        // nodes: persons, then shelters, then sink
+    
+    // Candidate edges as (shelter index, cost)
+    vector<vector<pair<int, long long>>> options(P);
+    for (int p = 0; p < P; p++) {
+        for (const CatchmentEntry& c : persons[p].options) {
+            options[p].push_back({shelterHandle(c.shelterID), batchCost(persons[p], c.distance)});
+        }
+    }
+    
+    vector<int> assigned(P, -1);             // shelter index
+    vector<long long> assignedCost(P, 0);
+    vector<vector<int>> members(S);          // persons placed in each shelter
+    vector<int> load(S, 0);
+    vector<long long> potential(P + S + 1, 0);
+    vector<long long> dist(P + S + 1, LLONG_MAX);
+    vector<int> parent(P + S + 1, -1);
+    vector<bool> done(P + S + 1, false);
+    vector<int> touched;
+    
+    int bedsLeft = 0;
+    for (int b : beds) bedsLeft += b;
+    
+    for (int p0 = 0; p0 < P && bedsLeft > 0; p0++) {
+        if (options[p0].empty()) continue;
+        
+        // Nothing leads into an unplaced person, so p0 may take any potential
+        // that keeps its own edges non-negative
+        long long highest = LLONG_MIN;
+        for (const auto& o : options[p0]) highest = max(highest, potential[P + o.first] - o.second);
+        potential[p0] = highest;
+        
+        priority_queue<pair<long long, int>, vector<pair<long long, int>>, greater<pair<long long, int>>> pq;
+        auto relax = [&](int from, int to, long long reduced) {
+            if (done[to] || dist[from] + reduced >= dist[to]) return;
+            if (dist[to] == LLONG_MAX) touched.push_back(to);
+            dist[to] = dist[from] + reduced;
+            parent[to] = from;
+            pq.push({dist[to], to});
+        };
+        
+        dist[p0] = 0;
+        touched.push_back(p0);
+        pq.push({0, p0});
+        
+        while (!pq.empty()) {
+            long long d = pq.top().first;
+            int u = pq.top().second;
+            pq.pop();
+            if (done[u] || d > dist[u]) continue;
+            done[u] = true;
+            if (u == sink) break;
+            
+            if (u < P) {
+                for (const auto& o : options[u]) {
+                    if (o.first == assigned[u]) continue;
+                    relax(u, P + o.first, o.second + potential[u] - potential[P + o.first]);
+                }
+            } else {
+                int s = u - P;
+                if (load[s] < beds[s]) relax(u, sink, potential[u] - potential[sink]);
+                for (int q : members[s]) {
+                    relax(u, q, -assignedCost[q] + potential[u] - potential[q]);
+                }
+            }
+        }
+        
+        if (done[sink]) {
+            // Walk back from the sink, moving every person on the path
+            load[parent[sink] - P]++;
+            bedsLeft--;
+            for (int v = parent[sink]; v != p0; ) {
+                int person = parent[v];
+                if (assigned[person] != -1) {
+                    vector<int>& old = members[assigned[person]];
+                    old.erase(find(old.begin(), old.end(), person));
+                }
+                assigned[person] = v - P;
+                for (const auto& o : options[person]) if (o.first == v - P) assignedCost[person] = o.second;
+                members[v - P].push_back(person);
+                v = (person == p0) ? p0 : parent[person];
+            }
+            
+            // Nodes move by min(distance, sink distance). Only differences
+            // matter, so subtracting the sink distance from everything leaves
+            // untouched nodes as they are.
+            long long limit = dist[sink];
+            for (int v : touched) potential[v] += min(dist[v], limit) - limit;
+        }
+        // Without a path the residual network is unchanged, and so are potentials
+        
+        for (int v : touched) {
+            dist[v] = LLONG_MAX;
+            parent[v] = -1;
+            done[v] = false;
+        }
+        touched.clear();
+    }
+    
+    BatchPlan plan;
+    plan.shelterOf.assign(P, -1);
+    for (int p = 0; p < P; p++) {
+        if (assigned[p] != -1) plan.shelterOf[p] = shelters[assigned[p]].id;
+    }
+    totalPlanDistance(persons, plan);
+    plan.ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    return plan;
+}
+
+void dropAllocatedFromEmergencyQueue() {
+    priority_queue<EmergencyCase> waiting;
+    while (!emergencyHeap.empty()) {
+        EmergencyCase ec = emergencyHeap.top();
+        emergencyHeap.pop();
+        Homeless* h = searchHomeless(ec.homelessID);
+        if (h && !h->allocated) waiting.push(ec);
+    }
+    emergencyHeap = waiting;
+}
+
+// Commits a plan and drops the placed persons from the emergency queue
+int applyBatchPlan(const vector<BatchPerson>& persons, const BatchPlan& plan) {
+    lock_guard<recursive_mutex> lock(shelterWrites);
+    vector<int> changed;
+    int placed = 0;
+    for (int p = 0; p < persons.size(); p++) {
+        Homeless* h = searchHomeless(persons[p].homelessID);
+        Shelter* s = findShelter(plan.shelterOf[p]);
+        if (!h || !s || h->allocated || !claimBeds(s->id)) continue;
+        assignToShelter(h, s);
+        changed.push_back(s->id);
+        placed++;
+    }
+    
+    sort(changed.begin(), changed.end());
+    changed.erase(unique(changed.begin(), changed.end()), changed.end());
+    for (int shelterID : changed) onShelterChanged(shelterID);
+    
+    dropAllocatedFromEmergencyQueue();
+    return placed;
+}
+
+// Reference min-cost flow by successive shortest paths found with
+// Bellman-Ford: slow, but it needs no potentials or early exits, so it checks
+// minCostBatchPlan() independently. Uses only the persons p with use[p] and
+// returns (persons placed, total cost) for a maximum flow of minimum cost.
+pair<int, long long> bellmanFordBatchFlow(const vector<BatchPerson>& persons, const vector<bool>& use, 
+                                          const vector<int>& beds) {
+    struct Arc {
+        int to;
+        int capacity;
+        long long cost;
+    };
+    int P = persons.size(), S = beds.size();
+    int source = P + S, sink = P + S + 1, N = P + S + 2;
+    vector<Arc> arcs;                   // arc a's reverse is a ^ 1
+    vector<vector<int>> out(N);
+    auto addArc = [&](int from, int to, int capacity, long long cost) {
+        out[from].push_back(arcs.size());
+        arcs.push_back({to, capacity, cost});
+        out[to].push_back(arcs.size());
+        arcs.push_back({from, 0, -cost});
+    };
+    for (int p = 0; p < P; p++) {
+        if (!use[p]) continue;
+        addArc(source, p, 1, 0);
+        for (const CatchmentEntry& c : persons[p].options) {
+            addArc(p, P + shelterHandle(c.shelterID), 1, batchCost(persons[p], c.distance));
+        }
+    }
+    for (int s = 0; s < S; s++) addArc(P + s, sink, beds[s], 0);
+    
+    int flow = 0;
+    long long cost = 0;
+    while (true) {
+        vector<long long> dist(N, LLONG_MAX);
+        vector<int> via(N, -1);
+        dist[source] = 0;
+        for (int round = 0; round < N; round++) {
+            bool changed = false;
+            for (int u = 0; u < N; u++) {
+                if (dist[u] == LLONG_MAX) continue;
+                for (int a : out[u]) {
+                    if (arcs[a].capacity > 0 && dist[u] + arcs[a].cost < dist[arcs[a].to]) {
+                        dist[arcs[a].to] = dist[u] + arcs[a].cost;
+                        via[arcs[a].to] = a;
+                        changed = true;
+                    }
+                }
+            }
+            if (!changed) break;
+        }
+        if (dist[sink] == LLONG_MAX) break;
+        
+        for (int v = sink; v != source; v = arcs[via[v] ^ 1].to) {
+            arcs[via[v]].capacity--;
+            arcs[via[v] ^ 1].capacity++;
+        }
+        flow++;
+        cost += dist[sink];
+    }
+    return {flow, cost};
+}
+
+// Solves `rounds` random small instances with minCostBatchPlan() and checks
+// each plan against the reference flow: every placement is one of the
+// person's candidates and fits the beds; each prefix of the priority order
+// houses as many persons as the reference can (so the plan houses the most
+// people, and no one lower down took a bed a higher priority needed); and
+// the persons chosen cost exactly the reference minimum for that set. The
+// live shelters are swapped out for the duration.
+bool batchAllocationSelfTest(int rounds) {
+    CityState live;
+    swapCityState(live);
+    
+    mt19937 rng(11);
+    int failures = 0, totalPersons = 0, totalPlaced = 0;
+    for (int round = 1; round <= rounds; round++) {
+        shelters.clear();
+        int shelterCount = 1 + rng() % 7;
+        for (int i = 0; i < shelterCount; i++) {
+            int capacity = 1 + rng() % 4;
+            shelters.push_back({100 + i, "Test Shelter", 0, capacity, (int)(rng() % (capacity + 1)), "", {}});
+        }
+        onSheltersReplaced();
+        
+        vector<BatchPerson> persons(1 + rng() % 25);
+        for (int p = 0; p < persons.size(); p++) {
+            persons[p] = {p + 1, (int)(rng() % 5) * 20, {}};
+            for (const Shelter& sh : shelters) {
+                if (rng() % 2) persons[p].options.push_back({sh.id, 1 + (int)(rng() % 60), -1});
+            }
+            sort(persons[p].options.begin(), persons[p].options.end(), 
+                 [](const CatchmentEntry& a, const CatchmentEntry& b) { return a.distance < b.distance; });
+        }
+        sort(persons.begin(), persons.end(), [](const BatchPerson& a, const BatchPerson& b) {
+            return a.priority != b.priority ? a.priority > b.priority : a.homelessID < b.homelessID;
+        });
+        
+        BatchPlan plan = minCostBatchPlan(persons);
+        vector<int> beds = freeBedsByHandle();
+        string problem;
+        
+        vector<int> used(shelters.size(), 0);
+        for (int p = 0; p < persons.size(); p++) {
+            if (plan.shelterOf[p] == -1) continue;
+            if (!catchmentFind(persons[p].options, plan.shelterOf[p])) problem = "placement is not a candidate";
+            else used[shelterHandle(plan.shelterOf[p])]++;
+        }
+        for (int s = 0; s < shelters.size(); s++) {
+            if (used[s] > beds[s]) problem = "shelter given more persons than free beds";
+        }
+        
+        vector<bool> prefix(persons.size(), false), chosen(persons.size(), false);
+        int placedSoFar = 0;
+        for (int p = 0; p < persons.size() && problem.empty(); p++) {
+            prefix[p] = true;
+            chosen[p] = plan.shelterOf[p] != -1;
+            placedSoFar += chosen[p];
+            if (bellmanFordBatchFlow(persons, prefix, beds).first != placedSoFar) {
+                problem = "first " + to_string(p + 1) + " by priority could house more";
+            }
+        }
+        if (problem.empty() && bellmanFordBatchFlow(persons, chosen, beds).second != plan.weightedDistance) {
+            problem = "plan costs more than the minimum for the persons it houses";
+        }
+        
+        totalPersons += persons.size();
+        totalPlaced += plan.placed;
+        if (!problem.empty()) {
+            failures++;
+            cout << RED << "  Instance " << round << RESET << ": " << problem << "\n";
+        }
+    }
+    
+    swapCityState(live);
+    cout << rounds << " instances, " << totalPersons << " persons, " << totalPlaced << " placed, " 
+         << failures << " failed\n";
+    return failures == 0;
+}
+
+// CONCURRENT INTAKE - Parallel routing, lock-free bed reservation
+// Several intake workers place people at once, alongside whatever else is
+// claiming beds. Each worker tries the shelters in its person's catchment
+// entry and, if all of those have been claimed in the meantime, runs one
+// Dijkstra that tries each shelter with beds left as it is settled. Every
+// attempt is claimBeds() on the registry's free-bed counter, the same counter
+// allocation, holds and batch plans use, so however the claims interleave no
+// shelter is promised more beds than it has. Records are written under
+// shelterWrites once every worker has finished.
+// Time Complexity: O(CATCHMENT_K) per person while catchment shelters have beds,
+//                  otherwise one search out to the claimed shelter
+// Space Complexity: O(S + P)
+struct IntakeResult {
+    int homelessID;
+    int shelterID;      // -1 when no bed could be reserved
+    int distance;
+    int lostClaims;     // shelters that filled up before this worker's claim
+};
+
+// Settles nodes outward from source and claims a bed at the first shelter
+// that still has one when it is reached
+void claimNearestBed(int source, IntakeResult& result) {
+    unordered_map<int, vector<int>> openAtNode;   // node -> handles with beds left
+    for (int handle = 0; handle < shelters.size(); handle++) {
+        if (bedsLeft(handle) > 0) openAtNode[shelters[handle].nodeID].push_back(handle);
+    }
+    
+    const CSRGraph& g = roadNetwork();
+    unordered_map<int, int> dist;
+    unordered_map<int, bool> settled;
+    priority_queue<pair<int, int>, vector<pair<int, int>>, greater<pair<int, int>>> pq;
+    dist[source] = 0;
+    pq.push({0, source});
+    
+    while (!pq.empty() && !openAtNode.empty()) {
+        int d = pq.top().first;
+        int u = pq.top().second;
+        pq.pop();
+        if (settled[u]) continue;
+        settled[u] = true;
+        
+        auto here = openAtNode.find(u);
+        if (here != openAtNode.end()) {
+            for (int handle : here->second) {
+                if (reserveBed(bedCounter(handle))) {
+                    result.shelterID = shelters[handle].id;
+                    result.distance = d;
+                    return;
+                }
+                result.lostClaims++;
+            }
+            openAtNode.erase(here);
+        }
+        
+        for (const Edge& e : g.neighbors(u)) {
+            auto it = dist.find(e.dest);
+            if (it == dist.end() || d + e.weight < it->second) {
+                dist[e.dest] = d + e.weight;
+                pq.push({d + e.weight, e.dest});
+            }
+        }
+    }
+}
+
+// node is -1 for a person who cannot be placed (gone or already allocated)
+IntakeResult intakeOne(int homelessID, int node, const vector<CatchmentEntry>& nearby) {
+    IntakeResult result = {homelessID, -1, -1, 0};
+    if (node < 0) return result;
+    
+    for (const CatchmentEntry& c : nearby) {
+        if (claimBeds(c.shelterID)) {
+            result.shelterID = c.shelterID;
+            result.distance = c.distance;
+            return result;
+        }
+        result.lostClaims++;
+    }
+    claimNearestBed(node, result);
+    return result;
+}
+
+// Places the given persons (in the order given) using threadCount workers
+vector<IntakeResult> concurrentIntake(const vector<int>& homelessIDs, int threadCount) {
+    // Everything the workers read is prepared first: the road network, the
+    // registry and a copy of each person's catchment entry
+    vector<int> nodes(homelessIDs.size(), -1);
+    vector<vector<CatchmentEntry>> nearby(homelessIDs.size());
+    {
+        lock_guard<recursive_mutex> lock(shelterWrites);
+        roadNetwork();
+        registry();
+        for (int i = 0; i < homelessIDs.size(); i++) {
+            const Homeless* h = searchHomeless(homelessIDs[i]);
+            if (!h || h->allocated || h->locationNodeID < 0 || h->locationNodeID >= nodeCount) continue;
+            nodes[i] = h->locationNodeID;
+            nearby[i] = rankedSheltersNear(nodes[i]);
+        }
+    }
+    
+    vector<IntakeResult> results(homelessIDs.size());
+    atomic<int> next(0);
+    auto worker = [&]() {
+        for (int i = next.fetch_add(1); i < homelessIDs.size(); i = next.fetch_add(1)) {
+            results[i] = intakeOne(homelessIDs[i], nodes[i], nearby[i]);
+        }
+    };
+    
+    vector<thread> workers;
+    for (int t = 1; t < max(1, threadCount); t++) workers.emplace_back(worker);
+    worker();
+    for (thread& w : workers) w.join();
+    
+    lock_guard<recursive_mutex> lock(shelterWrites);
+    vector<int> changed;
+    for (IntakeResult& r : results) {
+        if (r.shelterID == -1) continue;
+        Homeless* h = searchHomeless(r.homelessID);
+        Shelter* s = findShelter(r.shelterID);
+        if (!h || !s || h->allocated) {
+            // The record changed while the workers ran: give the bed back
+            returnBeds(r.shelterID);
+            r.shelterID = -1;
+            continue;
+        }
+        assignToShelter(h, s);
+        changed.push_back(r.shelterID);
+    }
+    sort(changed.begin(), changed.end());
+    changed.erase(unique(changed.begin(), changed.end()), changed.end());
+    for (int shelterID : changed) onShelterChanged(shelterID);
+    
+    dropAllocatedFromEmergencyQueue();
+    return results;
+}
+
+// Hammers reserveBed() from many threads, each also giving back some of the
+// beds it holds, and checks that beds in use never exceeded capacity and
+// that every bed is accounted for at the end.
+bool bedReservationStressTest(int shelterCount, int threadCount, int claimsPerThread) {
+    mt19937 rng(42);
+    vector<int> capacity(shelterCount);
+    vector<atomic<int>> freeBedsLeft(shelterCount);
+    vector<atomic<int>> inUse(shelterCount);
+    vector<atomic<int>> peakInUse(shelterCount);
+    for (int s = 0; s < shelterCount; s++) {
+        capacity[s] = 1 + rng() % 50;
+        freeBedsLeft[s].store(capacity[s]);
+        inUse[s].store(0);
+        peakInUse[s].store(0);
+    }
+    
+    vector<vector<int>> held(threadCount, vector<int>(shelterCount, 0));
+    auto worker = [&](int t) {
+        mt19937 local(t + 1);
+        for (int i = 0; i < claimsPerThread; i++) {
+            int s = local() % shelterCount;
+            if (held[t][s] > 0 && local() % 3 == 0) {
+                held[t][s]--;
+                inUse[s].fetch_sub(1);
+                freeBedsLeft[s].fetch_add(1);
+            } else if (reserveBed(freeBedsLeft[s])) {
+                held[t][s]++;
+                int now = inUse[s].fetch_add(1) + 1;
+                int peak = peakInUse[s].load();
+                while (now > peak && !peakInUse[s].compare_exchange_weak(peak, now)) {}
+            }
+        }
+    };
+    
+    vector<thread> workers;
+    for (int t = 0; t < threadCount; t++) workers.emplace_back(worker, t);
+    for (thread& w : workers) w.join();
+    
+    bool ok = true;
+    cout << left << setw(10) << "Shelter" << setw(12) << "Capacity" << setw(12) << "Peak Used" 
+         << setw(12) << "Held" << setw(12) << "Free" << "\n";
+    cout << string(58, '-') << "\n";
+    for (int s = 0; s < shelterCount; s++) {
+        int stillHeld = 0;
+        for (int t = 0; t < threadCount; t++) stillHeld += held[t][s];
+        int freeNow = freeBedsLeft[s].load();
+        bool good = peakInUse[s].load() <= capacity[s] && freeNow >= 0 && stillHeld + freeNow == capacity[s];
+        ok = ok && good;
+        cout << left << setw(10) << s << setw(12) << capacity[s] << setw(12) << peakInUse[s].load() 
+             << setw(12) << stillHeld << setw(12) << freeNow << (good ? "" : RED " ✗" RESET) << "\n";
+    }
+    return ok;
+}
+
+// Runs concurrentIntake() on a synthetic side x side grid, as two operators
+// placing halves of the waiting list at once, and checks after the commit
+// that no shelter is over capacity, that every placement was recorded, that
+// each registry counter still equals the shelter's free beds, and that as
+// many people were placed as there were people or beds.
+bool intakeGridSelfTest(int side, int rounds, int threadCount) {
+    CityState live;
+    swapCityState(live);
+    
+    mt19937 rng(7);
+    graph = buildGridCity(side, 1, 20, rng);
+    nodeCount = graph.size();
+    onRoadGraphChanged();
+    
+    bool ok = true;
+    cout << left << setw(8) << "Round" << setw(10) << "Persons" << setw(11) << "Free Beds" 
+         << setw(9) << "Placed" << "Over Capacity\n";
+    cout << string(50, '-') << "\n";
+    for (int round = 1; round <= rounds; round++) {
+        personStore = PersonStore();
+        personIDIndex = SortedIDIndex();
+        personColumns = PersonColumns();
+        personIndexes = PersonIndexes();
+        duplicateIndex = DuplicateIndex();
+        complaintIndex = ComplaintIndex();
+        emergencyHeap = priority_queue<EmergencyCase>();
+        
+        shelters.clear();
+        vector<int> occupiedBefore;
+        int totalFree = 0;
+        for (int i = 0; i < 40; i++) {
+            int capacity = 1 + rng() % 6;
+            int occupied = rng() % (capacity + 1);
+            shelters.push_back({i + 1, "Grid Shelter " + to_string(i + 1), (int)(rng() % nodeCount), 
+                                capacity, occupied, "", {}});
+            occupiedBefore.push_back(occupied);
+            totalFree += capacity - occupied;
+        }
+        onSheltersReplaced();
+        
+        int personCount = totalFree / 2 + rng() % (totalFree + 1);
+        vector<int> firstHalf, secondHalf;
+        for (int i = 0; i < personCount; i++) {
+            Homeless h = {};
+            h.id = i + 1;
+            h.name = "Grid Person " + to_string(i + 1);
+            h.locationNodeID = rng() % nodeCount;
+            h.allocatedShelterID = -1;
+            refreshPersonIndexes(insertPerson(h));
+            (i % 2 ? secondHalf : firstHalf).push_back(h.id);
+        }
+        
+        thread other([&]() { concurrentIntake(secondHalf, threadCount); });
+        concurrentIntake(firstHalf, threadCount);
+        other.join();
+        
+        int overCapacity = 0;
+        bool good = true;
+        for (int handle = 0; handle < shelters.size(); handle++) {
+            const Shelter& sh = shelters[handle];
+            if (sh.capacityOccupied > sh.capacityTotal) overCapacity++;
+            if (sh.allocatedPersonIDs.size() != sh.capacityOccupied - occupiedBefore[handle]) good = false;
+            if (bedsLeft(handle) != freeBeds(sh)) good = false;
+        }
+        int placed = 0;
+        forEachPerson([&](const Homeless& h) { if (h.allocated) placed++; });
+        good = good && overCapacity == 0 && placed == min(personCount, totalFree);
+        ok = ok && good;
+        
+        cout << left << setw(8) << round << setw(10) << personCount << setw(11) << totalFree 
+             << setw(9) << placed << overCapacity << (good ? "" : RED " ✗" RESET) << "\n";
+    }
+    
+    swapCityState(live);
+    return ok;
+}
+
+// BED HOLDS - Hierarchical timer wheel
+// A hold takes a bed out of the free pool for someone still on the way,
+// without allocating it. Each hold is a timer in the wheel: a timer lands in
+// the lowest ring whose span covers its due time, and when a lower ring wraps
+// the matching bucket of the ring above is poured back down. Every timer moves
+// at most LEVELS times before it fires, so scheduling, cancelling and expiring
+// are all O(1). Holds are expired lazily whenever the system is used.
+// Time Complexity: O(1) per hold to place, cancel or expire, plus one step per
+//                  elapsed second while holds are pending
+// Space Complexity: O(H) for H holds
+const int DEFAULT_HOLD_MINUTES = 30;
+
+void wheelInit(TimerWheel& w, long long now) {
+    w.now = now;
+    w.pending = 0;
+    for (int l = 0; l < TimerWheel::LEVELS; l++) {
+        for (int s = 0; s < TimerWheel::SLOTS; s++) w.head[l][s] = -1;
+    }
+}
+
+// Due times beyond the top ring are parked in its furthest bucket and
+// re-filed when that bucket comes round
+void wheelFile(TimerWheel& w, int id) {
+    long long due = w.due[id];
+    int level = 0;
+    while (level < TimerWheel::LEVELS - 1 
+           && (due >> (TimerWheel::SLOT_BITS * (level + 1))) != (w.now >> (TimerWheel::SLOT_BITS * (level + 1)))) {
+        level++;
+    }
+    int slot;
+    long long span = 1LL << (TimerWheel::SLOT_BITS * TimerWheel::LEVELS);
+    if (due - w.now >= span) {
+        slot = ((w.now >> (TimerWheel::SLOT_BITS * level)) - 1) & (TimerWheel::SLOTS - 1);
+    } else {
+        slot = (due >> (TimerWheel::SLOT_BITS * level)) & (TimerWheel::SLOTS - 1);
+    }
+    
+    int& first = w.head[level][slot];
+    w.where[id] = level * TimerWheel::SLOTS + slot;
+    w.prev[id] = -1;
+    w.next[id] = first;
+    if (first != -1) w.prev[first] = id;
+    first = id;
+}
+
+void wheelUnlink(TimerWheel& w, int id) {
+    int level = w.where[id] / TimerWheel::SLOTS, slot = w.where[id] % TimerWheel::SLOTS;
+    if (w.prev[id] != -1) w.next[w.prev[id]] = w.next[id];
+    else w.head[level][slot] = w.next[id];
+    if (w.next[id] != -1) w.prev[w.next[id]] = w.prev[id];
+}
+
+void wheelSchedule(TimerWheel& w, int id, long long due) {
+    if (id >= w.due.size()) {
+        w.due.resize(id + 1, -1);
+        w.next.resize(id + 1);
+        w.prev.resize(id + 1);
+        w.where.resize(id + 1);
+    }
+    w.due[id] = max(due, w.now + 1);    // this tick's bucket has already fired
+    w.pending++;
+    wheelFile(w, id);
+}
+
+void wheelCancel(TimerWheel& w, int id) {
+    if (id >= w.due.size() || w.due[id] == -1) return;
+    wheelUnlink(w, id);
+    w.due[id] = -1;
+    w.pending--;
+}
+
+// Moves the clock to `to`, appending the IDs of timers that fell due
+void wheelAdvance(TimerWheel& w, long long to, vector<int>& fired) {
+    while (w.now < to) {
+        if (w.pending == 0) {
+            w.now = to;
+            break;
+        }
+        w.now++;
+        
+        // Pour down the bucket of each ring that just wrapped
+        for (int level = 1; level < TimerWheel::LEVELS; level++) {
+            if ((w.now & ((1LL << (TimerWheel::SLOT_BITS * level)) - 1)) != 0) break;
+            int slot = (w.now >> (TimerWheel::SLOT_BITS * level)) & (TimerWheel::SLOTS - 1);
+            int id = w.head[level][slot];
+            w.head[level][slot] = -1;
+            while (id != -1) {
+                int following = w.next[id];
+                wheelFile(w, id);
+                id = following;
+            }
+        }
+        
+        int slot = w.now & (TimerWheel::SLOTS - 1);
+        int id = w.head[0][slot];
+        w.head[0][slot] = -1;
+        while (id != -1) {
+            int following = w.next[id];
+            w.due[id] = -1;
+            w.pending--;
+            fired.push_back(id);
+            id = following;
+        }
+    }
+}
+
+// Drives the wheel with random schedule, cancel and advance steps and checks
+// every advance against a brute-force model (a due time per ID, scanned in
+// full): the same timers must fire, each once, and the pending count must
+// agree. Due times reach 2^28 ticks out, so every ring and every pour-down
+// is used. Then times one million holds expiring over two hours.
+bool timerWheelSelfTest(int sequences) {
+    mt19937_64 rng(15);
+    int failures = 0;
+    long long advances = 0, firedTotal = 0;
+    
+    for (int sequence = 1; sequence <= sequences; sequence++) {
+        TimerWheel w;
+        wheelInit(w, rng() % (1LL << 30));
+        vector<long long> model;            // due tick per ID, -1 once fired or cancelled
+        string problem;
+        
+        for (int step = 0; step < 400 && problem.empty(); step++) {
+            int action = rng() % 10;
+            if (action < 5) {
+                long long span = rng() % 4 == 0 ? 1LL << (rng() % 28) : 200;
+                long long due = w.now + 1 + rng() % span;
+                wheelSchedule(w, model.size(), due);
+                model.push_back(due);
+            } else if (action < 7 && !model.empty()) {
+                int id = rng() % model.size();
+                if (model[id] != -1) {
+                    wheelCancel(w, id);
+                    model[id] = -1;
+                }
+            } else {
+                long long to = w.now + (rng() % 5 == 0 ? rng() % (1 << 20) : rng() % 300);
+                vector<int> fired;
+                wheelAdvance(w, to, fired);
+                sort(fired.begin(), fired.end());
+                
+                vector<int> expected;
+                int stillPending = 0;
+                for (int id = 0; id < model.size(); id++) {
+                    if (model[id] == -1) continue;
+                    if (model[id] <= to) {
+                        expected.push_back(id);
+                        model[id] = -1;
+                    } else {
+                        stillPending++;
+                    }
+                }
+                advances++;
+                firedTotal += fired.size();
+                if (fired != expected) problem = "fired " + to_string(fired.size()) + " timers, model " + to_string(expected.size());
+                else if (w.pending != stillPending) problem = "pending count differs from the model";
+            }
+        }
+        
+        if (!problem.empty()) {
+            failures++;
+            cout << RED << "  Sequence " << sequence << RESET << ": " << problem << "\n";
+        }
+    }
+    cout << sequences << " sequences, " << advances << " advances, " << firedTotal << " timers fired, " 
+         << failures << " failed\n";
+    
+    TimerWheel w;
+    wheelInit(w, 0);
+    vector<int> fired;
+    auto start = chrono::steady_clock::now();
+    for (int id = 0; id < 1000000; id++) wheelSchedule(w, id, 1 + rng() % 7200);
+    wheelAdvance(w, 7200, fired);
+    double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    cout << "1,000,000 holds placed and expired over 7200 ticks in " << fixed << setprecision(1) << ms << " ms\n";
+    
+    return failures == 0 && fired.size() == 1000000;
+}
+
+// Gives back the beds of every hold whose time is up
+int expireBedHolds() {
+    lock_guard<recursive_mutex> lock(shelterWrites);
+    if (!holdWheelStarted) return 0;
+    
+    vector<int> fired;
+    wheelAdvance(holdWheel, time(0), fired);
+    for (int id : fired) {
+        BedHold& hold = bedHolds[id];
+        hold.active = false;
+        Shelter* s = findShelter(hold.shelterID);
+        if (s) {
+            s->capacityHeld--;
+            returnBeds(s->id);
+            onShelterChanged(s->id);
+        }
+    }
+    return fired.size();
+}
+
+// Returns the hold ID, or -1 if the shelter has no free bed
+int holdBed(int shelterID, int homelessID, int minutes) {
+    lock_guard<recursive_mutex> lock(shelterWrites);
+    expireBedHolds();
+    Shelter* s = findShelter(shelterID);
+    if (!s || !claimBeds(shelterID)) return -1;
+    
+    if (!holdWheelStarted) {
+        wheelInit(holdWheel, time(0));
+        holdWheelStarted = true;
+    }
+    
+    int id = bedHolds.size();
+    bedHolds.push_back({id, shelterID, homelessID, time(0) + minutes * 60, true});
+    wheelSchedule(holdWheel, id, bedHolds[id].expiresAt);
+    s->capacityHeld++;
+    onShelterChanged(shelterID);
+    return id;
+}
+
+BedHold* findActiveHold(int holdID) {
+    expireBedHolds();
+    if (holdID < 0 || holdID >= bedHolds.size() || !bedHolds[holdID].active) return nullptr;
+    return &bedHolds[holdID];
+}
+
+// Releases the bed back to the pool
+bool cancelBedHold(int holdID) {
+    lock_guard<recursive_mutex> lock(shelterWrites);
+    BedHold* hold = findActiveHold(holdID);
+    if (!hold) return false;
+    
+    wheelCancel(holdWheel, holdID);
+    hold->active = false;
+    Shelter* s = findShelter(hold->shelterID);
+    if (s) {
+        s->capacityHeld--;
+        returnBeds(s->id);
+        onShelterChanged(s->id);
+    }
+    return true;
+}
+
+// The person arrived: the held bed becomes their allocation (the bed stays
+// claimed, so its counter does not change)
+bool confirmBedHold(int holdID) {
+    lock_guard<recursive_mutex> lock(shelterWrites);
+    BedHold* hold = findActiveHold(holdID);
+    if (!hold) return false;
+    Homeless* h = searchHomeless(hold->homelessID);
+    Shelter* s = findShelter(hold->shelterID);
+    if (!h || !s || h->allocated) return false;
+    
+    wheelCancel(holdWheel, holdID);
+    hold->active = false;
+    s->capacityHeld--;
+    assignToShelter(h, s);
+    onShelterChanged(s->id);
+    return true;
+}
+
+// Removes a record for good. Its bed and any beds held for it go back to
+// the pool first: once the slot is released nothing could free them.
+bool deleteHomelessRecord(int id) {
+    lock_guard<recursive_mutex> lock(shelterWrites);
+    int handle = personHandle(id);
+    if (handle < 0) return false;
+    
+    for (const BedHold& hold : bedHolds) {
+        if (hold.active && hold.homelessID == id) cancelBedHold(hold.id);
+    }
+    releaseFromShelter(&personAt(handle));
+    
+    onPersonRemoved(handle);
+    releasePersonSlot(handle);
+    return true;
+}
+
+// CONTRACTION HIERARCHIES - Preprocessed point-to-point routing
+// Nodes are contracted one at a time, least important first. Whenever removing
+// a node would break a shortest path between two of its neighbours, a shortcut
+// edge is added. A query then only climbs upward in rank from both ends and
+// meets in the middle, settling a few hundred nodes even on a city graph.
+// Time Complexity: preprocessing roughly O(V log V) with bounded witness
+//                  searches; query O(k log k) for the k nodes in the search spaces
+// Space Complexity: O(V + E + shortcuts)
+const int CH_WITNESS_SETTLE_LIMIT = 500;
+const char* CH_CACHE_FILE = "shelter_ch.cache";
+const unsigned CH_CACHE_MAGIC = 0x48434853; // "SHCH"
+const unsigned CH_CACHE_VERSION = 1;
+
+// FNV-1a over the CSR arrays, so a cached hierarchy is only reused for the
+// exact road network it was built from.
+unsigned long long graphFingerprint(const CSRGraph& g) {
+    unsigned long long hash = 1469598103934665603ULL;
+    auto mix = [&hash](int value) {
+        for (int i = 0; i < 4; i++) {
+            hash ^= (value >> (8 * i)) & 0xFF;
+            hash *= 1099511628211ULL;
+        }
+    };
+    mix(g.nodes());
+    for (int u = 0; u <= g.nodes(); u++) mix(g.offsets[u]);
+    for (int i = 0; i < g.edgeCount; i++) {
+        mix(g.edges[i].dest);
+        mix(g.edges[i].weight);
+    }
+    return hash;
+}
+
+// Keeps only the cheapest edge to each neighbour
+void addOrImproveCHEdge(vector<CHEdge>& list, CHEdge edge) {
+    for (CHEdge& existing : list) {
+        if (existing.dest == edge.dest) {
+            if (edge.weight < existing.weight) existing = edge;
+            return;
+        }
+    }
+    list.push_back(edge);
+}
+
+// Bounded Dijkstra from `source` over the remaining graph, avoiding `skip`.
+// Leaves results in `dist` and records every touched node so it can be reset.
+void chWitnessSearch(const vector<vector<CHEdge>>& out, const vector<bool>& contracted,
+                     int source, int skip, int maxDist,
+                     vector<int>& dist, vector<int>& touched) {
+    priority_queue<pair<int, int>, vector<pair<int, int>>, greater<pair<int, int>>> pq;
+    dist[source] = 0;
+    touched.push_back(source);
+    pq.push({0, source});
+    int settledCount = 0;
+    
+    while (!pq.empty() && settledCount < CH_WITNESS_SETTLE_LIMIT) {
+        int d = pq.top().first;
+        int u = pq.top().second;
+        pq.pop();
+        
+        if (d > dist[u]) continue;
+        if (d > maxDist) break;
+        settledCount++;
+        
+        for (const CHEdge& e : out[u]) {
+            if (e.dest == skip || contracted[e.dest]) continue;
+            if (d + e.weight < dist[e.dest]) {
+                if (dist[e.dest] == INT_MAX) touched.push_back(e.dest);
+                dist[e.dest] = d + e.weight;
+                pq.push({dist[e.dest], e.dest});
+            }
+        }
+    }
+}
+
+// Finds the shortcuts contracting v would need; adds them when `apply` is set.
+int contractNode(vector<vector<CHEdge>>& out, vector<vector<CHEdge>>& in,
+                 const vector<bool>& contracted, int v, bool apply,
+                 vector<int>& dist, vector<int>& touched) {
+    int maxOut = 0;
+    for (const CHEdge& e : out[v]) {
+        if (!contracted[e.dest]) maxOut = max(maxOut, e.weight);
+    }
+    
+    int shortcuts = 0;
+    vector<CHEdge> incoming = in[v];
+    vector<CHEdge> outgoing = out[v];
+    
+    for (const CHEdge& inEdge : incoming) {
+        int u = inEdge.dest;
+        if (u == v || contracted[u]) continue;
+        
+        chWitnessSearch(out, contracted, u, v, inEdge.weight + maxOut, dist, touched);
+        
+        for (const CHEdge& outEdge : outgoing) {
+            int w = outEdge.dest;
+            if (w == u || w == v || contracted[w]) continue;
+            
+            int viaV = inEdge.weight + outEdge.weight;
+            if (dist[w] <= viaV) continue;
+            
+            shortcuts++;
+            if (apply) {
+                addOrImproveCHEdge(out[u], {w, viaV, v});
+                addOrImproveCHEdge(in[w], {u, viaV, v});
+            }
+        }
+        
+        for (int t : touched) dist[t] = INT_MAX;
+        touched.clear();
+    }
+    
+    return shortcuts;
+}
+
+void flattenCHEdges(const vector<vector<CHEdge>>& lists, vector<int>& offsets, vector<CHEdge>& edges) {
+    offsets.assign(lists.size() + 1, 0);
+    edges.clear();
+    for (int u = 0; u < lists.size(); u++) {
+        edges.insert(edges.end(), lists[u].begin(), lists[u].end());
+        offsets[u + 1] = edges.size();
+    }
+}
+
+ContractionHierarchy buildContractionHierarchy(const CSRGraph& g) {
+    int n = g.nodes();
+    vector<vector<CHEdge>> out(n), in(n);
+    for (int u = 0; u < n; u++) {
+        for (const Edge& e : g.neighbors(u)) {
+            if (e.dest == u) continue;
+            addOrImproveCHEdge(out[u], {e.dest, e.weight, -1});
+            addOrImproveCHEdge(in[e.dest], {u, e.weight, -1});
+        }
+    }
+    
+    vector<bool> contracted(n, false);
+    vector<int> deletedNeighbours(n, 0), level(n, 0);
+    vector<int> dist(n, INT_MAX), touched;
+    
+    // Edge difference, contracted neighbours and hierarchy depth, so
+    // contraction spreads evenly instead of eating one region first
+    auto importance = [&](int v) {
+        int degree = 0;
+        for (const CHEdge& e : out[v]) if (!contracted[e.dest]) degree++;
+        for (const CHEdge& e : in[v]) if (!contracted[e.dest]) degree++;
+        int edgeDifference = contractNode(out, in, contracted, v, false, dist, touched) - degree;
+        return 2 * edgeDifference + deletedNeighbours[v] + level[v];
+    };
+    
+    priority_queue<pair<int, int>, vector<pair<int, int>>, greater<pair<int, int>>> order;
+    for (int v = 0; v < n; v++) order.push({importance(v), v});
+    
+    ContractionHierarchy ch;
+    ch.rank.assign(n, 0);
+    vector<vector<CHEdge>> upward(n), downward(n);
+    int nextRank = 0;
+    
+    while (!order.empty()) {
+        int v = order.top().second;
+        order.pop();
+        if (contracted[v]) continue;
+        
+        // Lazy update: re-check the importance before committing
+        int current = importance(v);
+        if (!order.empty() && current > order.top().first) {
+            order.push({current, v});
+            continue;
+        }
+        
+        contractNode(out, in, contracted, v, true, dist, touched);
+        
+        // Contracted neighbours were already unlinked, so what is left of
+        // v's lists all leads upward in the hierarchy
+        upward[v] = out[v];
+        downward[v] = in[v];
+        contracted[v] = true;
+        
+        auto unlink = [v](vector<CHEdge>& list) {
+            list.erase(remove_if(list.begin(), list.end(), 
+                                 [v](const CHEdge& e) { return e.dest == v; }), list.end());
+        };
+        for (const CHEdge& e : out[v]) unlink(in[e.dest]);
+        for (const CHEdge& e : in[v]) unlink(out[e.dest]);
+        
+        for (const CHEdge& e : out[v]) {
+            deletedNeighbours[e.dest]++;
+            level[e.dest] = max(level[e.dest], level[v] + 1);
+        }
+        for (const CHEdge& e : in[v]) {
+            deletedNeighbours[e.dest]++;
+            level[e.dest] = max(level[e.dest], level[v] + 1);
+        }
+        
+        ch.rank[v] = nextRank++;
+    }
+    
+    flattenCHEdges(upward, ch.upOffsets, ch.upEdges);
+    flattenCHEdges(downward, ch.downOffsets, ch.downEdges);
+    ch.fingerprint = graphFingerprint(g);
+    return ch;
+}
+
+template <typename T>
+void writeVector(ofstream& file, const vector<T>& data) {
+    unsigned long long count = data.size();
+    file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    file.write(reinterpret_cast<const char*>(data.data()), count * sizeof(T));
+}
+
+// The stored count is checked against what is left of the file before
+// anything is allocated for it
+template <typename T>
+bool readVector(ifstream& file, vector<T>& data) {
+    unsigned long long count = 0;
+    if (!file.read(reinterpret_cast<char*>(&count), sizeof(count))) return false;
+    streampos here = file.tellg();
+    file.seekg(0, ios::end);
+    unsigned long long bytesLeft = file.tellg() - here;
+    file.seekg(here);
+    if (count > bytesLeft / sizeof(T)) return false;
+    data.resize(count);
+    return (bool)file.read(reinterpret_cast<char*>(data.data()), count * sizeof(T));
+}
+
+bool saveContractionHierarchy(const ContractionHierarchy& ch, const string& path) {
+    ofstream file(path, ios::binary);
+    if (!file) return false;
+    
+    file.write(reinterpret_cast<const char*>(&CH_CACHE_MAGIC), sizeof(CH_CACHE_MAGIC));
+    file.write(reinterpret_cast<const char*>(&CH_CACHE_VERSION), sizeof(CH_CACHE_VERSION));
+    file.write(reinterpret_cast<const char*>(&ch.fingerprint), sizeof(ch.fingerprint));
+    writeVector(file, ch.rank);
+    writeVector(file, ch.upOffsets);
+    writeVector(file, ch.upEdges);
+    writeVector(file, ch.downOffsets);
+    writeVector(file, ch.downEdges);
+    return (bool)file;
+}
+
+// Offsets must run from 0 up to the edge count without falling back, and
+// every edge must name real nodes: queries index straight into these arrays
+bool validCHEdges(const vector<int>& offsets, const vector<CHEdge>& edges, int nodes) {
+    if (offsets.size() != nodes + 1 || offsets[0] != 0 || offsets[nodes] != edges.size()) return false;
+    for (int u = 0; u < nodes; u++) {
+        if (offsets[u + 1] < offsets[u]) return false;
+    }
+    for (const CHEdge& e : edges) {
+        if (e.dest < 0 || e.dest >= nodes || e.weight < 0 || e.middle < -1 || e.middle >= nodes) return false;
+    }
+    return true;
+}
+
+// False for a missing, stale or damaged cache, so the caller rebuilds
+bool loadContractionHierarchy(ContractionHierarchy& ch, const string& path, unsigned long long expectedFingerprint, 
+                              int nodes) {
+    ifstream file(path, ios::binary);
+    if (!file) return false;
+    
+    unsigned magic = 0, version = 0;
+    file.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+    file.read(reinterpret_cast<char*>(&version), sizeof(version));
+    file.read(reinterpret_cast<char*>(&ch.fingerprint), sizeof(ch.fingerprint));
+    if (!file || magic != CH_CACHE_MAGIC || version != CH_CACHE_VERSION) return false;
+    if (ch.fingerprint != expectedFingerprint) return false;
+    
+    bool read = readVector(file, ch.rank) && readVector(file, ch.upOffsets) && readVector(file, ch.upEdges) 
+             && readVector(file, ch.downOffsets) && readVector(file, ch.downEdges);
+    return read && ch.rank.size() == nodes && validCHEdges(ch.upOffsets, ch.upEdges, nodes) 
+        && validCHEdges(ch.downOffsets, ch.downEdges, nodes);
+}
+
+// BACKGROUND HIERARCHY REBUILD
+// A road change leaves the hierarchy stale. Rather than rebuilding it inside
+// the next query (an intake could stall for the whole preprocessing pass),
+// updateRoad() starts a rebuild on a worker thread over a snapshot of the
+// network. The next caller to look after it finishes installs it, unless the
+// roads changed again meanwhile, in which case a fresh rebuild starts.
+// Time Complexity: one preprocessing pass per burst of road changes
+// Space Complexity: O(V + E) for the snapshot while a rebuild runs
+future<ContractionHierarchy> hierarchyRebuild;
+
+void startHierarchyRebuild() {
+    if (hierarchyRebuild.valid()) return;     // a newer one starts when this lands
+    
+    const CSRGraph& g = roadNetwork();
+    vector<vector<Edge>> roads(g.nodes());
+    for (int u = 0; u < g.nodes(); u++) {
+        for (const Edge& e : g.neighbors(u)) roads[u].push_back(e);
+    }
+    CSRGraph snapshot = buildCSR(roads);
+    hierarchyRebuild = async(launch::async, [snapshot]() {
+        ContractionHierarchy ch = buildContractionHierarchy(snapshot);
+        saveContractionHierarchy(ch, CH_CACHE_FILE);
+        return ch;
+    });
+}
+
+// Installs a finished rebuild that matches the current roads. With `wait` it
+// blocks until one lands. Returns true when the hierarchy is current.
+bool collectHierarchyRebuild(bool wait) {
+    while (!roadCHValid && hierarchyRebuild.valid()) {
+        if (!wait && hierarchyRebuild.wait_for(chrono::seconds(0)) != future_status::ready) break;
+        
+        ContractionHierarchy ch = hierarchyRebuild.get();
+        if (ch.fingerprint == graphFingerprint(roadNetwork())) {
+            roadCH = move(ch);
+            roadCHValid = true;
+        } else {
+            startHierarchyRebuild();
+            if (!wait) break;
+        }
+    }
+    return roadCHValid;
+}
+
+// Loads the hierarchy for the current road network from the cache file, or
+// builds and saves it. Returns true when the cache was used.
+bool prepareContractionHierarchy() {
+    if (collectHierarchyRebuild(true)) return true;
+    
+    const CSRGraph& g = roadNetwork();
+    unsigned long long fingerprint = graphFingerprint(g);
+    
+    bool fromCache = loadContractionHierarchy(roadCH, CH_CACHE_FILE, fingerprint, g.nodes());
+    if (!fromCache) {
+        roadCH = buildContractionHierarchy(g);
+        saveContractionHierarchy(roadCH, CH_CACHE_FILE);
+    }
+    roadCHValid = true;
+    return fromCache;
+}
+
+// Appends the road nodes hidden behind edge from -> to (excluding `from`).
+// A shortcut through `middle` is two edges stored at middle, whose rank is
+// below both ends: from -> middle in its downward list, middle -> to upward.
+void unpackCHEdge(const ContractionHierarchy& ch, int from, int to, int middle, vector<int>& path) {
+    if (middle == -1) {
+        path.push_back(to);
+        return;
+    }
+    
+    int firstMiddle = -1, secondMiddle = -1;
+    for (int i = ch.downOffsets[middle]; i < ch.downOffsets[middle + 1]; i++) {
+        if (ch.downEdges[i].dest == from) firstMiddle = ch.downEdges[i].middle;
+    }
+    for (int i = ch.upOffsets[middle]; i < ch.upOffsets[middle + 1]; i++) {
+        if (ch.upEdges[i].dest == to) secondMiddle = ch.upEdges[i].middle;
+    }
+    
+    unpackCHEdge(ch, from, middle, firstMiddle, path);
+    unpackCHEdge(ch, middle, to, secondMiddle, path);
+}
+
+// Bidirectional upward search; returns INT_MAX when target is unreachable.
+// When `path` is given it receives the full road-level route. Labels live in
+// reusable per-node arrays reset through a touched list, and a node is
+// stalled when a higher neighbour already reaches it more cheaply, since no
+// shortest path can climb through it.
+int chShortestPath(int source, int target, vector<int>* path) {
+    prepareContractionHierarchy();
+    const ContractionHierarchy& ch = roadCH;
+    int n = ch.rank.size();
+    
+    static vector<int> dist[2], parent[2], middle[2], touched;
+    if (dist[0].size() != n) {
+        for (int side = 0; side < 2; side++) {
+            dist[side].assign(n, INT_MAX);
+            parent[side].assign(n, -1);
+            middle[side].assign(n, -1);
+        }
+    }
+    
+    priority_queue<pair<int, int>, vector<pair<int, int>>, greater<pair<int, int>>> pq[2];
+    const vector<int>* offsets[2] = {&ch.upOffsets, &ch.downOffsets};
+    const vector<CHEdge>* edges[2] = {&ch.upEdges, &ch.downEdges};
+    
+    dist[0][source] = 0;
+    dist[1][target] = 0;
+    touched.push_back(source);
+    touched.push_back(target);
+    pq[0].push({0, source});
+    pq[1].push({0, target});
+    
+    int best = INT_MAX, meeting = -1;
+    
+    while (!pq[0].empty() || !pq[1].empty()) {
+        int side = pq[1].empty() || (!pq[0].empty() && pq[0].top().first <= pq[1].top().first) ? 0 : 1;
+        int d = pq[side].top().first;
+        int u = pq[side].top().second;
+        pq[side].pop();
+        
+        if (d >= best) {
+            while (!pq[side].empty()) pq[side].pop();
+            continue;
+        }
+        if (d > dist[side][u]) continue;
+        
+        if (dist[1 - side][u] != INT_MAX && d + dist[1 - side][u] < best) {
+            best = d + dist[1 - side][u];
+            meeting = u;
+        }
+        
+        // Stall-on-demand: the opposite edge list of u holds its higher
+        // neighbours pointing back at it
+        const vector<int>& stallOffsets = *offsets[1 - side];
+        const vector<CHEdge>& stallEdges = *edges[1 - side];
+        bool stalled = false;
+        for (int i = stallOffsets[u]; i < stallOffsets[u + 1] && !stalled; i++) {
+            const CHEdge& e = stallEdges[i];
+            stalled = dist[side][e.dest] != INT_MAX && dist[side][e.dest] + e.weight < d;
+        }
+        if (stalled) continue;
+        
+        for (int i = (*offsets[side])[u]; i < (*offsets[side])[u + 1]; i++) {
+            const CHEdge& e = (*edges[side])[i];
+            if (d + e.weight < dist[side][e.dest]) {
+                if (dist[0][e.dest] == INT_MAX && dist[1][e.dest] == INT_MAX) touched.push_back(e.dest);
+                dist[side][e.dest] = d + e.weight;
+                parent[side][e.dest] = u;
+                middle[side][e.dest] = e.middle;
+                pq[side].push({d + e.weight, e.dest});
+            }
+        }
+    }
+    
+    if (path && meeting != -1) {
+        path->clear();
+        
+        vector<int> upChain;
+        for (int v = meeting; v != source; v = parent[0][v]) upChain.push_back(v);
+        upChain.push_back(source);
+        reverse(upChain.begin(), upChain.end());
+        
+        path->push_back(source);
+        for (int i = 1; i < upChain.size(); i++) {
+            unpackCHEdge(ch, upChain[i - 1], upChain[i], middle[0][upChain[i]], *path);
+        }
+        for (int v = meeting; v != target; v = parent[1][v]) {
+            unpackCHEdge(ch, v, parent[1][v], middle[1][v], *path);
+        }
+    }
+    
+    for (int v : touched) {
+        for (int side = 0; side < 2; side++) {
+            dist[side][v] = INT_MAX;
+            parent[side][v] = -1;
+            middle[side][v] = -1;
+        }
+    }
+    touched.clear();
+    
+    return best;
+}
+
+// Route from a person's node to the shelter they were just placed in. While
+// the hierarchy is stale this follows the catchment's `via` links, which the
+// road updates keep repaired, and falls back to a Dijkstra that stops once
+// the shelter's node is settled.
+int intakeRoute(int source, int shelterID, int target, vector<int>& path) {
+    if (collectHierarchyRebuild(false)) return chShortestPath(source, target, &path);
+    startHierarchyRebuild();
+    
+    path.assign(1, source);
+    const CatchmentEntry* first = catchmentFind(rankedSheltersNear(source), shelterID);
+    for (const CatchmentEntry* c = first; c && path.size() <= nodeCount; ) {
+        if (c->via == -1) return first->distance;
+        path.push_back(c->via);
+        c = catchmentFind(rankedSheltersNear(c->via), shelterID);
+    }
+    
+    const CSRGraph& g = roadNetwork();
+    unordered_map<int, int> dist, parent;
+    priority_queue<pair<int, int>, vector<pair<int, int>>, greater<pair<int, int>>> pq;
+    dist[source] = 0;
+    pq.push({0, source});
+    while (!pq.empty()) {
+        int d = pq.top().first;
+        int u = pq.top().second;
+        pq.pop();
+        if (d > dist[u]) continue;
+        if (u == target) {
+            path.clear();
+            for (int v = target; v != source; v = parent[v]) path.push_back(v);
+            path.push_back(source);
+            reverse(path.begin(), path.end());
+            return d;
+        }
+        for (const Edge& e : g.neighbors(u)) {
+            auto it = dist.find(e.dest);
+            if (it == dist.end() || d + e.weight < it->second) {
+                dist[e.dest] = d + e.weight;
+                parent[e.dest] = u;
+                pq.push({d + e.weight, e.dest});
+            }
+        }
+    }
+    path.clear();
+    return INT_MAX;
+}
+
+string formatRoute(const vector<int>& path) {
+    string route;
+    for (int i = 0; i < path.size(); i++) {
+        if (i > 0) route += " → ";
+        route += to_string(path[i]);
+    }
+    return route;
+}
+
+// DYNAMIC ROAD UPDATES - Incremental shortest-path repair
+// Roads stay two-way, so every update changes both directions at once.
+// A cheaper road can only improve distances reached through it, so repair
+// is a Dijkstra seeded at its ends that stops wherever nothing improves.
+// A longer or closed road only hurts the nodes whose shortest path used it:
+// the subtree hanging below it, which is reset and re-seeded from its border.
+// Time Complexity: O(A log A) where A is the number of nodes whose distance changes
+// Space Complexity: O(V) per cached tree
+ShortestPathTree buildShortestPathTree(int source) {
+    const CSRGraph& g = roadNetwork();
+    ShortestPathTree t;
+    t.source = source;
+    t.dist.assign(g.nodes(), INT_MAX);
+    t.parent.assign(g.nodes(), -1);
+    
+    priority_queue<pair<int, int>, vector<pair<int, int>>, greater<pair<int, int>>> pq;
+    t.dist[source] = 0;
+    pq.push({0, source});
+    
+    while (!pq.empty()) {
+        int d = pq.top().first;
+        int u = pq.top().second;
+        pq.pop();
+        if (d > t.dist[u]) continue;
+        
+        for (const Edge& e : g.neighbors(u)) {
+            if (d + e.weight < t.dist[e.dest]) {
+                t.dist[e.dest] = d + e.weight;
+                t.parent[e.dest] = u;
+                pq.push({t.dist[e.dest], e.dest});
+            }
+        }
+    }
+    
+    return t;
+}
+
+// Runs Dijkstra from already-seeded nodes; relaxes only into `allowed` nodes
+// when a mask is given. Returns the number of nodes settled.
+int propagateTree(ShortestPathTree& t, 
+                  priority_queue<pair<int, int>, vector<pair<int, int>>, greater<pair<int, int>>>& pq,
+                  const vector<bool>* allowed) {
+    const CSRGraph& g = roadNetwork();
+    int settledCount = 0;
+    
+    while (!pq.empty()) {
+        int d = pq.top().first;
+        int u = pq.top().second;
+        pq.pop();
+        if (d > t.dist[u]) continue;
+        settledCount++;
+        
+        for (const Edge& e : g.neighbors(u)) {
+            if (allowed && !(*allowed)[e.dest]) continue;
+            if (d + e.weight < t.dist[e.dest]) {
+                t.dist[e.dest] = d + e.weight;
+                t.parent[e.dest] = u;
+                pq.push({t.dist[e.dest], e.dest});
+            }
+        }
+    }
+    
+    return settledCount;
+}
+
+int repairTreeAfterShortening(ShortestPathTree& t, int u, int v, int weight) {
+    priority_queue<pair<int, int>, vector<pair<int, int>>, greater<pair<int, int>>> pq;
+    
+    int ends[2][2] = {{u, v}, {v, u}};
+    for (auto& end : ends) {
+        int from = end[0], to = end[1];
+        if (t.dist[from] != INT_MAX && t.dist[from] + weight < t.dist[to]) {
+            t.dist[to] = t.dist[from] + weight;
+            t.parent[to] = from;
+            pq.push({t.dist[to], to});
+        }
+    }
+    
+    return propagateTree(t, pq, nullptr);
+}
+
+int repairTreeAfterLengthening(ShortestPathTree& t, int u, int v) {
+    const CSRGraph& g = roadNetwork();
+    
+    int root = t.parent[v] == u ? v : (t.parent[u] == v ? u : -1);
+    if (root == -1) return 0;
+    
+    // Collect the subtree below the road through the parent links
+    vector<bool> affected(g.nodes(), false);
+    vector<int> subtree;
+    queue<int> q;
+    q.push(root);
+    affected[root] = true;
+    while (!q.empty()) {
+        int x = q.front();
+        q.pop();
+        subtree.push_back(x);
+        for (const Edge& e : g.neighbors(x)) {
+            if (!affected[e.dest] && t.parent[e.dest] == x) {
+                affected[e.dest] = true;
+                q.push(e.dest);
+            }
+        }
+    }
+    
+    for (int x : subtree) {
+        t.dist[x] = INT_MAX;
+        t.parent[x] = -1;
+    }
+    
+    priority_queue<pair<int, int>, vector<pair<int, int>>, greater<pair<int, int>>> pq;
+    for (int x : subtree) {
+        for (const Edge& e : g.neighbors(x)) {
+            if (affected[e.dest] || t.dist[e.dest] == INT_MAX) continue;
+            if (t.dist[e.dest] + e.weight < t.dist[x]) {
+                t.dist[x] = t.dist[e.dest] + e.weight;
+                t.parent[x] = e.dest;
+            }
+        }
+        if (t.dist[x] != INT_MAX) pq.push({t.dist[x], x});
+    }
+    
+    propagateTree(t, pq, &affected);
+    return subtree.size();
+}
+
+// Length of the road u -> v, or -1 when there is none
+int roadLength(int u, int v) {
+    materializeAdjacency();
+    int best = -1;
+    for (const Edge& e : graph[u]) {
+        if (e.dest == v && (best == -1 || e.weight < best)) best = e.weight;
+    }
+    return best;
+}
+
+// Sets the two-way road u - v to `weight`, opening it if needed; a negative
+// weight closes it. Cached distance trees and the shelter catchment are
+// repaired in place; the route hierarchy is rebuilt in the background.
+RoadUpdateStats updateRoad(int u, int v, int weight) {
+    RoadUpdateStats stats = {0, 0};
+    int oldWeight = roadLength(u, v);
+    if (weight < 0 && oldWeight < 0) return stats;
+    if (weight == oldWeight) return stats;
+    
+    bool structural = oldWeight < 0 || weight < 0;
+    int ends[2][2] = {{u, v}, {v, u}};
+    for (auto& end : ends) {
+        vector<Edge>& roads = graph[end[0]];
+        roads.erase(remove_if(roads.begin(), roads.end(), 
+                              [&end](const Edge& e) { return e.dest == end[1]; }), roads.end());
+        if (weight >= 0) roads.push_back({end[1], weight});
+    }
+    
+    // A pure weight change keeps the CSR layout, so patch it in place
+    if (roadCSRValid && !structural) {
+        for (auto& end : ends) {
+            for (int i = roadCSR.offsets[end[0]]; i < roadCSR.offsets[end[0] + 1]; i++) {
+                if (roadCSR.edges[i].dest == end[1]) roadCSR.edges[i].weight = weight;
+            }
+        }
+        roadCSR.maxWeight = max(roadCSR.maxWeight, weight);
+    } else {
+        roadCSRValid = false;
+    }
+    roadCHValid = false;
+    startHierarchyRebuild();
+    if (structural) roadComponentsValid = false;
+    
+    bool shorter = oldWeight < 0 || (weight >= 0 && weight < oldWeight);
+    for (auto& entry : distanceTrees) {
+        stats.treeNodesRepaired += shorter ? repairTreeAfterShortening(entry.second, u, v, weight)
+                                           : repairTreeAfterLengthening(entry.second, u, v);
+    }
+    if (shorter) {
+        catchmentOnRoadShortened(u, v, weight);
+    } else {
+        stats.catchmentNodesReranked = catchmentOnRoadLengthened(u, v);
+    }
+    
+    return stats;
+}
+
+// STATION ROUTE TREES - Cached shortest-path trees with route reconstruction
+// Stations are fixed intake points, so their trees are built once at startup
+// and updateRoad() keeps them valid afterwards. A route is read back by
+// walking parent links from the destination.
+// Time Complexity: O((V+E) log V) once per station, O(path length) per route
+// Space Complexity: O(V) per station
+const ShortestPathTree& cachedDistanceTree(int source) {
+    auto it = distanceTrees.find(source);
+    if (it == distanceTrees.end()) {
+        it = distanceTrees.emplace(source, buildShortestPathTree(source)).first;
+    }
+    return it->second;
+}
+
+void warmStationTrees() {
+    for (const Station& st : stations) {
+        cachedDistanceTree(st.nodeID);
+    }
+}
+
+// Empty when target is unreachable
+vector<int> reconstructRoute(const ShortestPathTree& t, int target) {
+    vector<int> route;
+    if (t.dist[target] == INT_MAX) return route;
+    
+    for (int v = target; v != -1; v = t.parent[v]) {
+        route.push_back(v);
+    }
+    reverse(route.begin(), route.end());
+    return route;
+}
+
+// SHELTER ALLOCATION SYSTEM using the catchment table
+void allocateShelter(int homelessID) {
+    printSubHeader("Catchment Table: Shelter Allocation System");
+    lock_guard<recursive_mutex> lock(shelterWrites);
+    expireBedHolds();
+    
+    Homeless* h = searchHomeless(homelessID);
+    if (!h) {
+        printError("Homeless person with ID " + to_string(homelessID) + " not found");
+        return;
+    }
+    
+    if (h->allocated) {
+        printWarning("Person already allocated to a shelter");
+        Shelter* current = findShelter(h->allocatedShelterID);
+        if (current) {
+            cout << "Current Shelter: " << current->name << "\n";
+        }
+        return;
+    }
+    
+    cout << "\nPerson Details:\n";
+    cout << "  Name: " << h->name << "\n";
+    cout << "  Location: Node " << h->locationNodeID << "\n";
+    cout << "  Priority Score: " << h->priorityScore << "\n\n";
+    
+    cout << "Looking up shelter catchment table...\n";
+    const vector<CatchmentEntry>& ranked = rankedSheltersNear(h->locationNodeID);
+    
+    // Claim a bed at the nearest shelter that still has one
+    int chosen = -1;
+    for (int i = 0; i < ranked.size() && chosen == -1; i++) {
+        if (claimBeds(ranked[i].shelterID)) chosen = i;
+    }
+    
+    cout << "\nNearest shelters with free beds:\n";
+    cout << left << setw(25) << "Shelter" << setw(12) << "Distance" << setw(12) << "Available" << setw(15) << "Status\n";
+    cout << string(64, '-') << "\n";
+    
+    for (int i = 0; i < ranked.size(); i++) {
+        const Shelter* s = findShelter(ranked[i].shelterID);
+        if (!s) continue;
+        string status = i == chosen ? GREEN "SELECTED" RESET : (bedsLeft(shelterHandle(s->id)) > 0 ? "Available" : "Full");
+        cout << left << setw(25) << s->name << setw(12) << ranked[i].distance 
+             << setw(12) << freeBeds(*s) << setw(15) << status << "\n";
+    }
+    
+    int bestShelter = chosen == -1 ? -1 : ranked[chosen].shelterID;
+    int minDist = chosen == -1 ? -1 : ranked[chosen].distance;
+    if (chosen == -1) {
+        // The catchment lists only the nearest few shelters. The component
+        // labels tell at once whether any shelter with a bed can be reached
+        // at all before the wider search is run.
+        bool reachableBed = false;
+        for (int handle = 0; handle < shelters.size() && !reachableBed; handle++) {
+            reachableBed = bedsLeft(handle) > 0 && isReachable(h->locationNodeID, shelters[handle].nodeID);
+        }
+        if (!reachableBed) {
+            printError("No shelter with a free bed can be reached from node " + to_string(h->locationNodeID) + 
+                       " (road component " + to_string(roadComponents().componentOf[h->locationNodeID]) + ")");
+            return;
+        }
+        
+        IntakeResult further = {h->id, -1, -1, 0};
+        claimNearestBed(h->locationNodeID, further);
+        if (further.shelterID == -1) {
+            printError("No available shelter found!");
+            return;
+        }
+        bestShelter = further.shelterID;
+        minDist = further.distance;
+    }
+    
+    // Update records
+    Shelter* s = findShelter(bestShelter);
+    assignToShelter(h, s);
+    
+    cout << "\n";
+    printSuccess("Allocation Successful!");
+    cout << GREEN << "  → Shelter: " << s->name << "\n";
+    cout << "  → Distance: " << minDist << " units\n";
+    
+    vector<int> route;
+    if (intakeRoute(h->locationNodeID, s->id, s->nodeID, route) != INT_MAX) {
+        cout << "  → Route: " << formatRoute(route) << "\n";
+    }
+    cout << "  → Contact: " << s->contactNumber << RESET << "\n";
+    
+    onShelterChanged(bestShelter);
+    onPersonChanged(homelessID);
+}
+
+// COMPLAINT CLASSIFICATION
+string classifyComplaint(const string& complaint) {
+    int mask = matchComplaint(complaint).categories;
+    
+    vector<string> categories;
+    for (int c = 0; c < complaintRules.categoryNames.size(); c++) {
+        if (mask & (1 << c)) categories.push_back(complaintRules.categoryNames[c]);
+    }
+    
+    if (categories.empty()) {
+        return "General";
+    } else if (categories.size() == 1) {
+        return categories[0];
+    } else {
+        string result = categories[0];
+        for (int i = 1; i < categories.size(); i++) {
+            result += ", " + categories[i];
+        }
+        return result;
+    }
+}
+
+// ==================== CITY DATA LOADING ====================
+
+// ROAD NETWORK FILES - Streaming text parser and memory-mapped binary format
+// Text files are read a line at a time and never held whole in memory:
+//   DIMACS:    "p sp <nodes> <arcs>" then "a <u> <v> <w>" (1-based, one direction)
+//   Edge list: "<u> <v> <w>" (0-based, two-way road)
+// Lines starting with 'c' or '#' are comments. Every road in the system is
+// two-way, so a DIMACS arc whose reverse the file does not list gets one
+// added with the same weight. Arcs are bucketed straight into CSR order with
+// a counting sort. The binary format is that CSR image behind a short
+// header; it is mapped copy-on-write and used in place, so loading costs one
+// validation pass and no parsing or copying.
+// Time Complexity: O(V + E) to load either format, plus O(E log E) to pair
+//                  up DIMACS arcs
+// Space Complexity: O(V + E) for text, O(1) heap for a mapped binary file
+const unsigned GRAPH_FILE_MAGIC = 0x52474853; // "SHGR"
+const unsigned GRAPH_FILE_VERSION = 1;
+
+struct GraphFileHeader {
+    unsigned magic;
+    unsigned version;
+    int nodeCount;
+    int edgeCount;
+};
+
+const char* skipSpaces(const char* p) {
+    while (*p == ' ' || *p == '\t') p++;
+    return p;
+}
+
+// Reads `count` integers from p; false if any is missing
+bool parseInts(const char* p, long* values, int count) {
+    for (int i = 0; i < count; i++) {
+        char* end;
+        values[i] = strtol(p, &end, 10);
+        if (end == p) return false;
+        p = end;
+    }
+    return true;
+}
+
+bool loadTextGraph(const string& path, CSRGraph& out) {
+    FILE* file = fopen(path.c_str(), "r");
+    if (!file) return false;
+    fseek(file, 0, SEEK_END);
+    long fileBytes = ftell(file);
+    rewind(file);
+    
+    vector<int> from;
+    vector<Edge> arcs;
+    long declaredNodes = 0, maxNode = -1;
+    bool oneWayArcs = false;
+    bool ok = true;
+    char line[512];
+    
+    while (ok && fgets(line, sizeof(line), file)) {
+        const char* p = skipSpaces(line);
+        long v[4];
+        
+        if (*p == 'c' || *p == '#' || *p == '\n' || *p == '\r' || *p == '\0') {
+            continue;
+        } else if (*p == 'p') {
+            p = skipSpaces(p + 1);
+            while (*p && *p != ' ' && *p != '\t') p++;   // problem type, e.g. "sp"
+            ok = parseInts(p, v, 2) && v[0] >= 0 && v[0] < INT_MAX && v[1] >= 0;
+            if (ok) {
+                declaredNodes = v[0];
+                // The arc count is only a hint: an arc line is at least 8 bytes,
+                // so a file cannot hold more arcs than that allows
+                long expectedArcs = min(v[1], max(0L, fileBytes) / 8);
+                from.reserve(expectedArcs);
+                arcs.reserve(expectedArcs);
+            }
+        } else if (*p == 'a') {
+            ok = parseInts(p + 1, v, 3) && v[0] >= 1 && v[1] >= 1 && v[2] >= 0 && v[2] <= INT_MAX / 2;
+            if (ok) {
+                from.push_back(v[0] - 1);
+                arcs.push_back({(int)(v[1] - 1), (int)v[2]});
+                maxNode = max(maxNode, max(v[0], v[1]) - 1);
+                oneWayArcs = true;
+            }
+        } else {
+            ok = parseInts(p, v, 3) && v[0] >= 0 && v[1] >= 0 && v[2] >= 0 && v[2] <= INT_MAX / 2;
+            if (ok) {
+                from.push_back(v[0]);
+                arcs.push_back({(int)v[1], (int)v[2]});
+                from.push_back(v[1]);
+                arcs.push_back({(int)v[0], (int)v[2]});
+                maxNode = max(maxNode, max(v[0], v[1]));
+            }
+        }
+        ok = ok && maxNode < INT_MAX - 1 && arcs.size() < (size_t)INT_MAX;
+    }
+    fclose(file);
+    if (!ok) return false;
+    
+    if (oneWayArcs) {
+        vector<pair<int, int>> listed(arcs.size());
+        for (size_t i = 0; i < arcs.size(); i++) listed[i] = {from[i], arcs[i].dest};
+        sort(listed.begin(), listed.end());
+        size_t fileArcs = arcs.size();
+        for (size_t i = 0; i < fileArcs; i++) {
+            pair<int, int> reverse = {arcs[i].dest, from[i]};
+            if (!binary_search(listed.begin(), listed.end(), reverse)) {
+                from.push_back(reverse.first);
+                arcs.push_back({reverse.second, arcs[i].weight});
+            }
+        }
+        if (arcs.size() >= (size_t)INT_MAX) return false;
+    }
+    
+    int n = max(declaredNodes, maxNode + 1);
+    shared_ptr<CSRStorage> store = make_shared<CSRStorage>();
+    store->offsets.assign(n + 1, 0);
+    for (int u : from) store->offsets[u + 1]++;
+    for (int u = 0; u < n; u++) store->offsets[u + 1] += store->offsets[u];
+    
+    vector<int> next(store->offsets.begin(), store->offsets.end() - 1);
+    store->edges.resize(arcs.size());
+    for (size_t i = 0; i < arcs.size(); i++) {
+        store->edges[next[from[i]]++] = arcs[i];
+    }
+    
+    out = viewCSR(store->offsets.data(), store->edges.data(), n, store);
+    return true;
+}
+
+bool saveBinaryGraph(const CSRGraph& g, const string& path) {
+    ofstream file(path, ios::binary);
+    if (!file) return false;
+    
+    GraphFileHeader header = {GRAPH_FILE_MAGIC, GRAPH_FILE_VERSION, g.nodeCount, g.edgeCount};
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(g.offsets), sizeof(int) * (g.nodeCount + 1));
+    file.write(reinterpret_cast<const char*>(g.edges), sizeof(Edge) * g.edgeCount);
+    return (bool)file;
+}
+
+// Checks the arrays before they are trusted: a bad offset or destination
+// would otherwise send traversals outside the mapping.
+bool validCSR(const int* offsets, const Edge* edges, int nodes, int edgeCount) {
+    if (offsets[0] != 0 || offsets[nodes] != edgeCount) return false;
+    for (int u = 0; u < nodes; u++) {
+        if (offsets[u + 1] < offsets[u]) return false;
+    }
+    for (int i = 0; i < edgeCount; i++) {
+        if (edges[i].dest < 0 || edges[i].dest >= nodes || edges[i].weight < 0) return false;
+    }
+    return true;
+}
+
+#ifndef _WIN32
+bool loadBinaryGraph(const string& path, CSRGraph& out) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size < (off_t)sizeof(GraphFileHeader)) {
+        close(fd);
+        return false;
+    }
+    
+    size_t size = info.st_size;
+    // Private writable mapping: updateRoad() can patch weights in place
+    // without ever writing them back to the file.
+    void* base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) return false;
+    shared_ptr<void> mapping(base, [size](void* p) { munmap(p, size); });
+    
+    const GraphFileHeader* header = static_cast<const GraphFileHeader*>(base);
+    if (header->magic != GRAPH_FILE_MAGIC || header->version != GRAPH_FILE_VERSION) return false;
+    if (header->nodeCount < 0 || header->edgeCount < 0) return false;
+    
+    size_t expected = sizeof(GraphFileHeader) + sizeof(int) * ((size_t)header->nodeCount + 1) 
+                    + sizeof(Edge) * (size_t)header->edgeCount;
+    if (size != expected) return false;
+    
+    const int* offsets = reinterpret_cast<const int*>(header + 1);
+    Edge* edges = reinterpret_cast<Edge*>(const_cast<int*>(offsets + header->nodeCount + 1));
+    if (!validCSR(offsets, edges, header->nodeCount, header->edgeCount)) return false;
+    
+    out = viewCSR(offsets, edges, header->nodeCount, mapping);
+    return true;
+}
+#else
+// No mmap here: read the same image into memory instead
+bool loadBinaryGraph(const string& path, CSRGraph& out) {
+    ifstream file(path, ios::binary);
+    GraphFileHeader header;
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header))) return false;
+    if (header.magic != GRAPH_FILE_MAGIC || header.version != GRAPH_FILE_VERSION) return false;
+    if (header.nodeCount < 0 || header.edgeCount < 0) return false;
+    
+    shared_ptr<CSRStorage> store = make_shared<CSRStorage>();
+    store->offsets.resize(header.nodeCount + 1);
+    store->edges.resize(header.edgeCount);
+    file.read(reinterpret_cast<char*>(store->offsets.data()), sizeof(int) * store->offsets.size());
+    file.read(reinterpret_cast<char*>(store->edges.data()), sizeof(Edge) * store->edges.size());
+    if (!file) return false;
+    if (!validCSR(store->offsets.data(), store->edges.data(), header.nodeCount, header.edgeCount)) return false;
+    
+    out = viewCSR(store->offsets.data(), store->edges.data(), header.nodeCount, store);
+    return true;
+}
+#endif
+
+// Picks the format from the file's first bytes
+bool loadGraphFile(const string& path, CSRGraph& out, bool& binary) {
+    unsigned magic = 0;
+    ifstream probe(path, ios::binary);
+    if (!probe) return false;
+    probe.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+    probe.close();
+    
+    binary = (magic == GRAPH_FILE_MAGIC);
+    return binary ? loadBinaryGraph(path, out) : loadTextGraph(path, out);
+}
+
+// FACILITY FILES - Shelters and stations, one per line
+//   s <id> <node> <capacityTotal> <capacityOccupied> <contact> <name...>
+//   t <id> <node> <name...>
+// Time Complexity: O(lines)
+// Space Complexity: O(facilities)
+bool loadFacilities(const string& path, vector<Shelter>& newShelters, vector<Station>& newStations) {
+    ifstream file(path);
+    if (!file) return false;
+    
+    string line;
+    while (getline(file, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        istringstream in(line);
+        string kind;
+        if (!(in >> kind) || kind[0] == '#' || kind[0] == 'c') continue;
+        
+        if (kind == "s") {
+            Shelter s;
+            if (!(in >> s.id >> s.nodeID >> s.capacityTotal >> s.capacityOccupied >> s.contactNumber)) return false;
+            if (s.capacityTotal <= 0 || s.capacityOccupied < 0 || s.capacityOccupied > s.capacityTotal) return false;
+            getline(in >> ws, s.name);
+            newShelters.push_back(s);
+        } else if (kind == "t") {
+            Station st;
+            if (!(in >> st.id >> st.nodeID)) return false;
+            getline(in >> ws, st.name);
+            newStations.push_back(st);
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Every node the rest of the system refers to must exist in the new network
+bool facilitiesFitNetwork(int nodes, const vector<Shelter>& shelterSet, const vector<Station>& stationSet) {
+    for (const Shelter& s : shelterSet) {
+        if (s.nodeID < 0 || s.nodeID >= nodes) return false;
+    }
+    for (const Station& st : stationSet) {
+        if (st.nodeID < 0 || st.nodeID >= nodes) return false;
+    }
+    bool fits = true;
+    forEachPerson([&](const Homeless& h) {
+        if (h.locationNodeID >= nodes) fits = false;
+    });
+    return fits;
+}
+
+// Resident set size of this process, or -1 where /proc is unavailable
+long residentMemoryKB() {
+#ifndef _WIN32
+    ifstream statm("/proc/self/statm");
+    long totalPages = 0, residentPages = 0;
+    if (statm >> totalPages >> residentPages) {
+        return residentPages * (sysconf(_SC_PAGESIZE) / 1024);
+    }
+#endif
+    return -1;
+}
+
+// Allocations and holds still name the shelters that were just replaced.
+// A file's occupied count already covers everyone in a bed, so a person
+// whose shelter ID is still listed stays allocated there (raising the count
+// if the file left them out); anyone else goes back to waiting. Holds are
+// dropped, since the file's counts know nothing of them.
+void reconcileWithNewShelters() {
+    lock_guard<recursive_mutex> lock(shelterWrites);
+    for (BedHold& hold : bedHolds) {
+        if (!hold.active) continue;
+        wheelCancel(holdWheel, hold.id);
+        hold.active = false;
+    }
+    
+    vector<int> allocatedIDs;
+    forEachPerson([&](const Homeless& h) {
+        if (h.allocated) allocatedIDs.push_back(h.id);
+    });
+    for (int id : allocatedIDs) {
+        Homeless* h = searchHomeless(id);
+        Shelter* s = findShelter(h->allocatedShelterID);
+        bool listed = s && find(s->allocatedPersonIDs.begin(), s->allocatedPersonIDs.end(), id) 
+                           != s->allocatedPersonIDs.end();
+        if (s && !listed && s->allocatedPersonIDs.size() < s->capacityTotal) {
+            s->allocatedPersonIDs.push_back(id);
+            s->capacityOccupied = max(s->capacityOccupied, (int)s->allocatedPersonIDs.size());
+            listed = true;
+        }
+        if (!listed) {
+            h->allocated = false;
+            h->allocatedShelterID = -1;
+        }
+        onPersonChanged(id);
+    }
+    onSheltersReplaced();
+}
+
+// Replaces the road network (and, if facilitiesPath is not empty, the
+// shelters and stations). Nothing changes unless everything loads.
+bool loadCityData(const string& graphPath, const string& facilitiesPath, bool& binary) {
+    CSRGraph loaded;
+    if (!loadGraphFile(graphPath, loaded, binary)) return false;
+    
+    vector<Shelter> newShelters = shelters;
+    vector<Station> newStations = stations;
+    if (!facilitiesPath.empty()) {
+        newShelters.clear();
+        newStations.clear();
+        if (!loadFacilities(facilitiesPath, newShelters, newStations)) return false;
+    }
+    if (!facilitiesFitNetwork(loaded.nodeCount, newShelters, newStations)) return false;
+    
+    lock_guard<recursive_mutex> lock(shelterWrites);
+    onRoadGraphChanged();
+    graph.clear();      // rebuilt from the CSR only if a road is edited
+    roadCSR = loaded;
+    roadCSRValid = true;
+    nodeCount = loaded.nodeCount;
+    shelters = newShelters;
+    stations = newStations;
+    onSheltersReplaced();
+    if (!facilitiesPath.empty()) reconcileWithNewShelters();
+    return true;
+}
+
+// ==================== SUBSYSTEM 1: REGISTRATION & DATA MANAGEMENT ====================
+
+const int PERSON_PAGE_SIZE = 20;
+
+void printPersonTableHeader() {
+    cout << left << setw(6) << "ID" << setw(20) << "Name" << setw(6) << "Age" 
+         << setw(10) << "Gender" << setw(10) << "Priority" << setw(12) << "Allocated\n";
+    cout << string(64, '-') << "\n";
+}
+
+void printPersonRow(const Homeless& h) {
+    cout << left << setw(6) << h.id << setw(20) << h.name.substr(0, 18) 
+         << setw(6) << h.age << setw(10) << h.gender 
+         << setw(10) << h.priorityScore 
+         << setw(12) << (h.allocated ? GREEN "Yes" RESET : "No") << "\n";
+}
+
+void registrationMenu() {
+    while (true) {
+        clearScreen();
+        printHeader("REGISTRATION & DATA MANAGEMENT SUBSYSTEM");
+        
+        cout << "\n1. Register New Homeless Person\n";
+        cout << "2. Search Person by ID (Binary Search)\n";
+        cout << "3. View All Registered Persons\n";
+        cout << "4. Update Person Information\n";
+        cout << "5. Calculate Priority Score\n";
+        cout << "6. Delete Record\n";
+        cout << "7. List Persons by ID Range\n";
+        cout << "8. Benchmark Record Table (unordered_map vs Flat)\n";
+        cout << "9. Benchmark Duplicate Check (MinHash + LSH)\n";
+        cout << "10. Search Complaints by Words (AND/OR)\n";
+        cout << "11. Benchmark Complaint Word Index\n";
+        cout << "0. Back to Main Menu\n";
+        cout << "\n" << CYAN << "Enter choice: " << RESET;
+        
+        int choice;
+        cin >> choice;
+        cin.ignore();
+        
+        if (choice == 0) break;
+        
+        switch (choice) {
+            case 1: {
+                clearScreen();
+                printSubHeader("Register New Homeless Person");
+                
+                Homeless h;
+                h.id = nextHomelessID++;
+                
+                cout << "Auto-generated ID: " << h.id << "\n\n";
+                cout << "Enter Name: ";
+                getline(cin, h.name);
+                
+                cout << "Enter Age: ";
+                cin >> h.age;
+                cin.ignore();
+                
+                cout << "Enter Gender (Male/Female): ";
+                getline(cin, h.gender);
+                
+                cout << "Enter Location Node ID (0-" << nodeCount - 1 << "): ";
+                cin >> h.locationNodeID;
+                cin.ignore();
+                
+                cout << "Medical Need? (1=Yes, 0=No): ";
+                cin >> h.medicalNeed;
+                cin.ignore();
+                
+                cout << "Enter Complaint/Issue: ";
+                getline(cin, h.complaint);
+                
+                int compared = 0;
+                auto checkStart = chrono::steady_clock::now();
+                vector<DuplicateMatch> similar = findNearDuplicates(duplicateIndex, h.name, h.complaint, &compared);
+                double checkMs = chrono::duration<double, milli>(chrono::steady_clock::now() - checkStart).count();
+                if (!similar.empty()) {
+                    printWarning("Possible duplicate registration:");
+                    for (int i = 0; i < similar.size() && i < 5; i++) {
+                        const Homeless& other = personAt(similar[i].handle);
+                        cout << "  ID " << other.id << ": " << other.name << ", age " << other.age 
+                             << ", node " << other.locationNodeID << " (name " << (int)(similar[i].nameSimilarity * 100) 
+                             << "%, complaint " << (int)(similar[i].complaintSimilarity * 100) << "% similar)\n";
+                    }
+                    cout << "(" << compared << " candidates compared in " << fixed << setprecision(3) << checkMs << " ms)\n";
+                    cout << "Register anyway? (y/n): ";
+                    string answer;
+                    getline(cin, answer);
+                    if (answer != "y" && answer != "Y") {
+                        printInfo("Registration cancelled");
+                        pressEnterToContinue();
+                        break;
+                    }
+                }
+                
+                calculatePriority(h);
+                
+                if (addHomelessRecord(h)) {
+                    cout << "\nPriority Score: " << h.priorityScore << "\n";
+                    cout << "Complaint Category: " << classifyComplaint(h.complaint) << "\n";
+                    
+                    if (h.priorityScore > 80) {
+                        printWarning("HIGH PRIORITY CASE - Adding to emergency queue");
+                        addEmergencyCase({h.id, h.priorityScore, time(0)});
+                    }
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 2: {
+                clearScreen();
+                printSubHeader("Search Person by ID");
+                
+                int id;
+                cout << "Enter ID to search: ";
+                cin >> id;
+                cin.ignore();
+                
+                cout << "\nPerforming Binary Search...\n";
+                int handle = binarySearchRecord(id);
+                
+                if (handle >= 0) {
+                    Homeless* found = &personAt(handle);
+                    cout << "\n" << GREEN << "═══ Person Found ═══" << RESET << "\n";
+                    cout << "ID: " << found->id << "\n";
+                    cout << "Name: " << found->name << "\n";
+                    cout << "Age: " << found->age << "\n";
+                    cout << "Gender: " << found->gender << "\n";
+                    cout << "Location Node: " << found->locationNodeID << "\n";
+                    cout << "Medical Need: " << (found->medicalNeed ? "Yes" : "No") << "\n";
+                    cout << "Priority Score: " << found->priorityScore << "\n";
+                    cout << "Complaint: " << found->complaint << "\n";
+                    cout << "Category: " << classifyComplaint(found->complaint) << "\n";
+                    cout << "Allocated: " << (found->allocated ? "Yes" : "No") << "\n";
+                    if (found->allocated) {
+                        cout << "Shelter ID: " << found->allocatedShelterID << "\n";
+                    }
+                } else {
+                    printError("Person not found");
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 3: {
+                clearScreen();
+                printSubHeader("All Registered Persons");
+                
+                if (personCount() == 0) {
+                    printWarning("No records found");
+                } else {
+                    // One page at a time in ID order, resuming after the last ID shown
+                    int lastID = INT_MIN, shown = 0;
+                    while (true) {
+                        vector<int> page = personsAfterID(lastID, PERSON_PAGE_SIZE);
+                        if (page.empty()) break;
+                        
+                        printPersonTableHeader();
+                        for (int handle : page) {
+                            printPersonRow(personAt(handle));
+                        }
+                        lastID = personAt(page.back()).id;
+                        shown += page.size();
+                        
+                        if (shown >= personCount()) break;
+                        cout << "\nShowing " << shown << " of " << personCount() << ". Next page? (y/n): ";
+                        string answer;
+                        getline(cin, answer);
+                        if (answer != "y" && answer != "Y") break;
+                        cout << "\n";
+                    }
+                    
+                    cout << "\nTotal: " << personCount() << " persons\n";
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 4: {
+                clearScreen();
+                printSubHeader("Update Person Information");
+                
+                int id;
+                cout << "Enter ID: ";
+                cin >> id;
+                cin.ignore();
+                
+                Homeless* h = searchHomeless(id);
+                if (!h) {
+                    printError("Person not found");
+                } else {
+                    cout << "\nCurrent Details:\n";
+                    cout << "Name: " << h->name << "\n";
+                    cout << "Complaint: " << h->complaint << "\n\n";
+                    
+                    cout << "Update Complaint (leave blank to keep current): ";
+                    string newComplaint;
+                    getline(cin, newComplaint);
+                    
+                    if (!newComplaint.empty()) {
+                        h->complaint = newComplaint;
+                        calculatePriority(*h);
+                        onPersonChanged(id);
+                        onPersonTextChanged(id);
+                        printSuccess("Record updated. New priority: " + to_string(h->priorityScore));
+                    }
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 5: {
+                clearScreen();
+                printSubHeader("Recalculate Priority Scores");
+                
+                forEachPerson([](Homeless& h) {
+                    calculatePriority(h);
+                    onPersonChanged(h.id);
+                });
+                
+                printSuccess("All priority scores recalculated");
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 6: {
+                clearScreen();
+                printSubHeader("Delete Record");
+                
+                int id;
+                cout << "Enter ID to delete: ";
+                cin >> id;
+                cin.ignore();
+                
+                // Note the person's shelter so the returned bed can be checked
+                Homeless* h = searchHomeless(id);
+                int shelterID = h && h->allocated ? h->allocatedShelterID : -1;
+                int handle = shelterHandle(shelterID);
+                int bedsBefore = handle == -1 ? 0 : bedsLeft(handle);
+                
+                if (deleteHomelessRecord(id)) {
+                    printSuccess("Record deleted");
+                    if (handle != -1) {
+                        const Shelter& sh = shelters[handle];
+                        if (bedsLeft(handle) == bedsBefore + 1 && bedsLeft(handle) == freeBeds(sh)) {
+                            printSuccess("Bed at " + sh.name + " returned (" + to_string(freeBeds(sh)) + " free)");
+                        } else {
+                            printError("Bed at " + sh.name + " was not returned!");
+                        }
+                    }
+                } else {
+                    printError("Record not found");
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 7: {
+                clearScreen();
+                printSubHeader("List Persons by ID Range");
+                
+                int lo, hi;
+                cout << "From ID: ";
+                cin >> lo;
+                cout << "To ID: ";
+                cin >> hi;
+                cin.ignore();
+                
+                vector<int> handles = personsInIDRange(lo, hi);
+                if (handles.empty()) {
+                    printWarning("No persons in that ID range");
+                } else {
+                    printPersonTableHeader();
+                    for (int handle : handles) {
+                        printPersonRow(personAt(handle));
+                    }
+                    cout << "\n" << handles.size() << " persons with IDs " << lo << "-" << hi << "\n";
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 8: {
+                clearScreen();
+                int count;
+                cout << "Number of synthetic records (e.g. 1000000): ";
+                cin >> count;
+                cin.ignore();
+                
+                if (count <= 0) {
+                    printError("Record count must be positive");
+                } else {
+                    benchmarkRecordTable(count);
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 9: {
+                clearScreen();
+                int count;
+                cout << "Number of synthetic records (e.g. 1000000): ";
+                cin >> count;
+                cin.ignore();
+                
+                if (count <= 0) {
+                    printError("Record count must be positive");
+                } else {
+                    benchmarkDuplicateCheck(count);
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 10: {
+                clearScreen();
+                printSubHeader("Search Complaints by Words");
+                
+                cout << "Words must all appear; OR separates alternatives\n";
+                cout << "(e.g. \"insulin cold OR diabetic\"): ";
+                string query;
+                getline(cin, query);
+                
+                auto start = chrono::steady_clock::now();
+                vector<int> ids = queryComplaintIndex(complaintIndex, query);
+                double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+                
+                if (ids.empty()) {
+                    printWarning("No complaints match");
+                } else {
+                    cout << "\n" << ids.size() << " match(es) in " << fixed << setprecision(3) << ms << " ms\n\n";
+                    printPersonTableHeader();
+                    for (int i = 0; i < ids.size() && i < 20; i++) printPersonRow(personAt(personHandle(ids[i])));
+                    if (ids.size() > 20) cout << "... and " << ids.size() - 20 << " more\n";
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 11: {
+                clearScreen();
+                int count;
+                cout << "Number of synthetic complaints (e.g. 1000000): ";
+                cin >> count;
+                cin.ignore();
+                
+                if (count <= 0) {
+                    printError("Complaint count must be positive");
+                } else {
+                    benchmarkComplaintIndex(count);
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            default:
+                printError("Invalid choice");
+                pressEnterToContinue();
+        }
+    }
+}
+
+// ==================== SUBSYSTEM 2: SHELTER ALLOCATION & MANAGEMENT ====================
+
+void shelterManagementMenu() {
+    while (true) {
+        clearScreen();
+        printHeader("SHELTER ALLOCATION & MANAGEMENT SUBSYSTEM");
+        expireBedHolds();
+        
+        cout << "\n1. Allocate Shelter (Dijkstra's Algorithm)\n";
+        cout << "2. View Shelter Status\n";
+        cout << "3. Rank Shelters (Merge Sort)\n";
+        cout << "4. Check Shelter Connectivity (Union-Find)\n";
+        cout << "5. Update Shelter Capacity\n";
+        cout << "6. View Allocated Persons per Shelter\n";
+        cout << "7. Release Person from Shelter\n";
+        cout << "8. Find Shelters with Free Beds\n";
+        cout << "9. Hold Bed for Person En Route\n";
+        cout << "10. Confirm or Cancel Bed Hold\n";
+        cout << "11. Merge Sort Self-Test (vs std::sort)\n";
+        cout << "12. Bed Hold Timer Wheel Self-Test\n";
+        cout << "0. Back to Main Menu\n";
+        cout << "\n" << CYAN << "Enter choice: " << RESET;
+        
+        int choice;
+        cin >> choice;
+        cin.ignore();
+        
+        if (choice == 0) break;
+        
+        switch (choice) {
+            case 1: {
+                clearScreen();
+                int id;
+                cout << "Enter Homeless Person ID: ";
+                cin >> id;
+                cin.ignore();
+                allocateShelter(id);
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 2: {
+                clearScreen();
+                printSubHeader("Shelter Status Overview");
+                
+                cout << left << setw(25) << "Shelter Name" << setw(10) << "Node" 
+                     << setw(10) << "Total" << setw(10) << "Occupied" << setw(10) << "Held" << setw(10) << "Available" 
+                     << setw(15) << "Utilization\n";
+                cout << string(90, '-') << "\n";
+                
+                for (const Shelter& s : shelters) {
+                    int available = freeBeds(s);
+                    double util = (s.capacityOccupied * 100.0) / s.capacityTotal;
+                    
+                    cout << left << setw(25) << s.name << setw(10) << s.nodeID 
+                         << setw(10) << s.capacityTotal << setw(10) << s.capacityOccupied << setw(10) << s.capacityHeld 
+                         << setw(10) << available << setw(15) << fixed << setprecision(1) << util << "%\n";
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 3: {
+                clearScreen();
+                printSubHeader("Rank Shelters");
+                
+                int key, fromNode = -1;
+                cout << "1. Available beds\n2. Utilization\n3. Distance from a node\n";
+                cout << "Rank by: ";
+                cin >> key;
+                if (key == 3) {
+                    cout << "Enter node: ";
+                    cin >> fromNode;
+                }
+                cin.ignore();
+                
+                if (key < 1 || key > 3 || (key == 3 && (fromNode < 0 || fromNode >= nodeCount))) {
+                    printError("Invalid choice");
+                } else {
+                    cout << "\n";
+                    displayShelterRanking((ShelterRankKey)(key - 1), fromNode);
+                }
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 4: {
+                clearScreen();
+                checkShelterConnectivity();
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 5: {
+                clearScreen();
+                printSubHeader("Update Shelter Capacity");
+                
+                int shelterID;
+                cout << "Enter Shelter ID: ";
+                cin >> shelterID;
+                
+                Shelter* s = findShelter(shelterID);
+                if (s) {
+                    cout << "Current Capacity: " << s->capacityTotal << "\n";
+                    cout << "Enter New Total Capacity: ";
+                    int newCap;
+                    cin >> newCap;
+                    
+                    // Shrinking claims the removed beds, so it fails if they are in use
+                    lock_guard<recursive_mutex> lock(shelterWrites);
+                    int change = newCap - s->capacityTotal;
+                    if (change >= 0 || claimBeds(shelterID, -change)) {
+                        if (change > 0) returnBeds(shelterID, change);
+                        s->capacityTotal = newCap;
+                        onShelterChanged(s->id);
+                        printSuccess("Capacity updated");
+                    } else {
+                        printError("Cannot set capacity below occupied and held beds");
+                    }
+                } else {
+                    printError("Shelter not found");
+                }
+                
+                cin.ignore();
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 6: {
+                clearScreen();
+                printSubHeader("Allocated Persons per Shelter");
+                
+                for (const Shelter& s : shelters) {
+                    cout << "\n" << BOLD << s.name << RESET << " (Occupied: " 
+                         << s.capacityOccupied << "/" << s.capacityTotal << ")\n";
+                    cout << string(50, '-') << "\n";
+                    
+                    if (s.allocatedPersonIDs.empty()) {
+                        cout << "  No allocations\n";
+                    } else {
+                        for (int pid : s.allocatedPersonIDs) {
+                            Homeless* h = searchHomeless(pid);
+                            if (h) {
+                                cout << "  • " << h->name << " (ID: " << pid << ", Priority: " 
+                                     << h->priorityScore << ")\n";
+                            }
+                        }
+                    }
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 7: {
+                clearScreen();
+                printSubHeader("Release Person from Shelter");
+                
+                int id;
+                cout << "Enter Homeless Person ID: ";
+                cin >> id;
+                cin.ignore();
+                
+                Homeless* h = searchHomeless(id);
+                if (!h) {
+                    printError("Person not found");
+                } else if (!h->allocated) {
+                    printWarning("Person is not allocated to any shelter");
+                } else {
+                    Shelter* s = findShelter(h->allocatedShelterID);
+                    releaseFromShelter(h);
+                    if (s) printSuccess("Person released from " + s->name);
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 8: {
+                clearScreen();
+                printSubHeader("Find Shelters with Free Beds");
+                
+                int minBeds;
+                cout << "Minimum free beds needed: ";
+                cin >> minBeds;
+                cin.ignore();
+                
+                int most = mostFreeShelter();
+                if (most == -1) {
+                    printWarning("Every shelter is full");
+                } else {
+                    cout << "\nMost free: " << shelters[most].name << " (" << freeBeds(shelters[most]) << " beds)\n\n";
+                    
+                    vector<int> matches = sheltersWithFreeBeds(minBeds);
+                    cout << left << setw(8) << "ID" << setw(25) << "Shelter Name" << setw(10) << "Node" 
+                         << setw(10) << "Free" << "\n";
+                    cout << string(53, '-') << "\n";
+                    for (int handle : matches) {
+                        const Shelter& sh = shelters[handle];
+                        cout << left << setw(8) << sh.id << setw(25) << sh.name << setw(10) << sh.nodeID 
+                             << setw(10) << freeBeds(sh) << "\n";
+                    }
+                    printSuccess(to_string(matches.size()) + " shelters with at least " 
+                                 + to_string(max(minBeds, 1)) + " free beds");
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 9: {
+                clearScreen();
+                printSubHeader("Hold Bed for Person En Route");
+                
+                int id, shelterID, minutes;
+                cout << "Enter Homeless Person ID: ";
+                cin >> id;
+                cout << "Enter Shelter ID: ";
+                cin >> shelterID;
+                cout << "Hold for how many minutes (0 = " << DEFAULT_HOLD_MINUTES << "): ";
+                cin >> minutes;
+                cin.ignore();
+                if (minutes <= 0) minutes = DEFAULT_HOLD_MINUTES;
+                
+                Homeless* h = searchHomeless(id);
+                if (!h) {
+                    printError("Person not found");
+                } else if (h->allocated) {
+                    printWarning("Person is already allocated to a shelter");
+                } else {
+                    int holdID = holdBed(shelterID, id, minutes);
+                    if (holdID == -1) {
+                        printError("Shelter not found or has no free bed");
+                    } else {
+                        printSuccess("Bed held at " + findShelter(shelterID)->name + " for " 
+                                     + to_string(minutes) + " minutes (Hold ID: " + to_string(holdID) + ")");
+                    }
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 10: {
+                clearScreen();
+                printSubHeader("Confirm or Cancel Bed Hold");
+                
+                cout << left << setw(10) << "Hold ID" << setw(20) << "Person" << setw(22) << "Shelter" 
+                     << setw(14) << "Expires In" << "\n";
+                cout << string(66, '-') << "\n";
+                bool any = false;
+                for (const BedHold& hold : bedHolds) {
+                    if (!hold.active) continue;
+                    any = true;
+                    Homeless* h = searchHomeless(hold.homelessID);
+                    Shelter* sh = findShelter(hold.shelterID);
+                    long long secondsLeft = max(0LL, (long long)(hold.expiresAt - time(0)));
+                    cout << left << setw(10) << hold.id << setw(20) << (h ? h->name.substr(0, 18) : "?") 
+                         << setw(22) << (sh ? sh->name : "?") 
+                         << setw(14) << (to_string(secondsLeft / 60) + "m " + to_string(secondsLeft % 60) + "s") << "\n";
+                }
+                
+                if (!any) {
+                    printInfo("No active holds");
+                } else {
+                    int holdID, action;
+                    cout << "\nEnter Hold ID: ";
+                    cin >> holdID;
+                    cout << "1. Confirm (person arrived)  2. Cancel hold: ";
+                    cin >> action;
+                    cin.ignore();
+                    
+                    if (action == 1 && confirmBedHold(holdID)) {
+                        printSuccess("Hold confirmed - bed allocated");
+                    } else if (action == 2 && cancelBedHold(holdID)) {
+                        printSuccess("Hold cancelled - bed returned");
+                    } else {
+                        printError("Hold not found, expired, or person already allocated");
+                    }
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 11: {
+                clearScreen();
+                printSubHeader("Merge Sort Self-Test");
+                
+                int threads = max(7u, thread::hardware_concurrency());   // odd counts leave a run unpaired
+                cout << "rankShelters() against std::sort, 0 to 200,000 shelters on 1-" << threads << " threads:\n\n";
+                if (rankSheltersSelfTest(threads)) {
+                    printSuccess("Merge sort order matches std::sort for every key");
+                } else {
+                    printError("Merge sort order differs from std::sort!");
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 12: {
+                clearScreen();
+                printSubHeader("Timer Wheel Self-Test");
+                
+                int sequences;
+                cout << "Number of random sequences (e.g. 200): ";
+                cin >> sequences;
+                
+                if (sequences < 1 || sequences > 100000) {
+                    printError("Sequence count must be between 1 and 100000");
+                } else {
+                    cout << "\nTimer wheel checked against a brute-force model:\n";
+                    if (timerWheelSelfTest(sequences)) {
+                        printSuccess("Every timer fired exactly when the model said");
+                    } else {
+                        printError("Timer wheel differs from the model!");
+                    }
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            default:
+                printError("Invalid choice");
+                pressEnterToContinue();
+        }
+    }
+}
+
+// ==================== SUBSYSTEM 3: EMERGENCY MANAGEMENT ====================
+
+void emergencyManagementMenu() {
+    while (true) {
+        clearScreen();
+        printHeader("EMERGENCY MANAGEMENT SUBSYSTEM");
+        expireBedHolds();
+        
+        cout << "\n1. View Emergency Queue\n";
+        cout << "2. Handle Next Emergency (Max Heap)\n";
+        cout << "3. Add Person to Emergency Queue\n";
+        cout << "4. View High Priority Cases\n";
+        cout << "5. Emergency Allocation (Auto)\n";
+        cout << "6. Batch Allocation (Min-Cost Flow)\n";
+        cout << "7. Concurrent Intake (All Waiting Persons)\n";
+        cout << "8. Bed Reservation Stress Test\n";
+        cout << "9. Outreach Sweep at Location\n";
+        cout << "10. Batch Allocation Self-Test (vs Bellman-Ford)\n";
+        cout << "0. Back to Main Menu\n";
+        cout << "\n" << CYAN << "Enter choice: " << RESET;
+        
+        int choice;
+        cin >> choice;
+        cin.ignore();
+        
+        if (choice == 0) break;
+        
+        switch (choice) {
+            case 1: {
+                clearScreen();
+                printSubHeader("Emergency Queue Status");
+                
+                if (emergencyHeap.empty()) {
+                    printInfo("No pending emergencies");
+                } else {
+                    cout << "Pending Emergencies: " << emergencyHeap.size() << "\n\n";
+                    
+                    // Create temp copy to display without removing
+                    priority_queue<EmergencyCase> tempHeap = emergencyHeap;
+                    int rank = 1;
+                    
+                    cout << left << setw(6) << "Rank" << setw(12) << "Person ID" 
+                         << setw(12) << "Priority" << setw(25) << "Name\n";
+                    cout << string(55, '-') << "\n";
+                    
+                    while (!tempHeap.empty()) {
+                        EmergencyCase ec = tempHeap.top();
+                        tempHeap.pop();
+                        
+                        Homeless* h = searchHomeless(ec.homelessID);
+                        string name = h ? h->name : "Unknown";
+                        
+                        cout << left << setw(6) << rank++ << setw(12) << ec.homelessID 
+                             << setw(12) << ec.priority << setw(25) << name << "\n";
+                    }
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 2: {
+                clearScreen();
+                printSubHeader("Handle Next Emergency");
+                
+                if (emergencyHeap.empty()) {
+                    printInfo("No pending emergencies");
+                } else {
+                    EmergencyCase ec = getNextEmergency();
+                    
+                    Homeless* h = searchHomeless(ec.homelessID);
+                    if (h) {
+                        cout << RED << "🚨 EMERGENCY CASE 🚨" << RESET << "\n\n";
+                        cout << "Person: " << h->name << "\n";
+                        cout << "Priority: " << ec.priority << "\n";
+                        cout << "Complaint: " << h->complaint << "\n\n";
+                        
+                        if (!h->allocated) {
+                            cout << "Attempting emergency allocation...\n\n";
+                            allocateShelter(ec.homelessID);
+                        } else {
+                            printInfo("Person already allocated to shelter");
+                        }
+                    }
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 3: {
+                clearScreen();
+                printSubHeader("Add Person to Emergency Queue");
+                
+                int id;
+                cout << "Enter Homeless Person ID: ";
+                cin >> id;
+                cin.ignore();
+                
+                Homeless* h = searchHomeless(id);
+                if (!h) {
+                    printError("Person not found");
+                } else {
+                    calculatePriority(*h);
+                    onPersonChanged(id);
+                    addEmergencyCase({id, h->priorityScore, time(0)});
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 4: {
+                clearScreen();
+                printSubHeader("High Priority Cases (Priority > 80)");
+                
+                vector<int> handles = personsAbovePriority(80);
+                cout << left << setw(6) << "ID" << setw(20) << "Name" << setw(12) << "Priority" 
+                     << setw(30) << "Complaint\n";
+                cout << string(68, '-') << "\n";
+                
+                for (int handle : handles) {
+                    const Homeless& h = personAt(handle);
+                    cout << left << setw(6) << h.id << setw(20) << h.name.substr(0, 18) 
+                         << setw(12) << h.priorityScore 
+                         << setw(30) << h.complaint.substr(0, 28) << "\n";
+                }
+                
+                if (handles.empty()) {
+                    printInfo("No high priority cases");
+                } else {
+                    cout << "\n" << handles.size() << " of " << personCount() << " registered persons\n";
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 5: {
+                clearScreen();
+                printSubHeader("Emergency Auto-Allocation");
+                
+                int allocated = 0;
+                while (!emergencyHeap.empty()) {
+                    EmergencyCase ec = getNextEmergency();
+                    Homeless* h = searchHomeless(ec.homelessID);
+                    
+                    if (h && !h->allocated) {
+                        cout << "\nProcessing: " << h->name << " (Priority: " << ec.priority << ")\n";
+                        allocateShelter(ec.homelessID);
+                        allocated++;
+                    }
+                }
+                
+                cout << "\n";
+                printSuccess("Processed " + to_string(allocated) + " emergency cases");
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 6: {
+                clearScreen();
+                printSubHeader("Batch Allocation (Min-Cost Flow)");
+                
+                vector<BatchPerson> persons = collectBatchPersons();
+                if (persons.empty()) {
+                    printInfo("No unallocated persons");
+                    pressEnterToContinue();
+                    break;
+                }
+                
+                BatchPlan greedy = greedyBatchPlan(persons);
+                BatchPlan batch = minCostBatchPlan(persons);
+                
+                // Travel of the urgent cases, the ones greedy tends to strand
+                auto urgentAverage = [&](const BatchPlan& plan) {
+                    long long total = 0;
+                    int count = 0;
+                    for (int p = 0; p < persons.size(); p++) {
+                        const CatchmentEntry* c = catchmentFind(persons[p].options, plan.shelterOf[p]);
+                        if (c && persons[p].priority > 80) {
+                            total += c->distance;
+                            count++;
+                        }
+                    }
+                    return count ? (double)total / count : 0.0;
+                };
+                
+                cout << "Waiting persons: " << persons.size() << "   (each considers the " 
+                     << BATCH_CANDIDATES << " nearest open shelters)\n\n";
+                cout << left << setw(32) << "Metric" << setw(16) << "Greedy" << setw(16) << "Batch" << "\n";
+                cout << string(64, '-') << "\n";
+                cout << left << setw(32) << "Persons placed" << setw(16) << greedy.placed << setw(16) << batch.placed << "\n";
+                cout << left << setw(32) << "Total travel distance" << setw(16) << greedy.totalDistance 
+                     << setw(16) << batch.totalDistance << "\n";
+                cout << left << setw(32) << "Priority-weighted distance" << setw(16) << greedy.weightedDistance 
+                     << setw(16) << batch.weightedDistance << "\n";
+                cout << left << setw(32) << "Avg distance (priority > 80)" << fixed << setprecision(1) 
+                     << setw(16) << urgentAverage(greedy) << setw(16) << urgentAverage(batch) << "\n";
+                cout << left << setw(32) << "Solve time (ms)" << setprecision(2) << setw(16) << greedy.ms 
+                     << setw(16) << batch.ms << "\n";
+                
+                int apply;
+                cout << "\nApply batch plan? (1 = Yes, 0 = No): ";
+                cin >> apply;
+                cin.ignore();
+                
+                if (apply == 1) {
+                    int placed = applyBatchPlan(persons, batch);
+                    printSuccess("Allocated " + to_string(placed) + " persons");
+                } else {
+                    printInfo("Plan discarded");
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 7: {
+                clearScreen();
+                printSubHeader("Concurrent Intake");
+                
+                // Highest priority first, so those are claimed first
+                vector<pair<int, int>> waiting;
+                for (int handle : unallocatedPersons()) {
+                    const Homeless& h = personAt(handle);
+                    waiting.push_back({-h.priorityScore, h.id});
+                }
+                sort(waiting.begin(), waiting.end());
+                vector<int> ids;
+                for (const auto& w : waiting) ids.push_back(w.second);
+                
+                if (ids.empty()) {
+                    printInfo("No unallocated persons");
+                    pressEnterToContinue();
+                    break;
+                }
+                
+                int threads = max(1u, thread::hardware_concurrency());
+                auto start = chrono::steady_clock::now();
+                vector<IntakeResult> results = concurrentIntake(ids, threads);
+                double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+                
+                cout << left << setw(8) << "ID" << setw(20) << "Name" << setw(22) << "Shelter" 
+                     << setw(10) << "Distance" << setw(12) << "Lost Claims" << "\n";
+                cout << string(72, '-') << "\n";
+                int placed = 0;
+                for (const IntakeResult& r : results) {
+                    const Shelter* sh = findShelter(r.shelterID);
+                    const Homeless* h = searchHomeless(r.homelessID);
+                    cout << left << setw(8) << r.homelessID << setw(20) << (h ? h->name.substr(0, 18) : "-") 
+                         << setw(22) << (sh ? sh->name : "-") << setw(10) << (sh ? to_string(r.distance) : "-") 
+                         << setw(12) << r.lostClaims << "\n";
+                    if (sh) placed++;
+                }
+                
+                bool overCapacity = false;
+                for (const Shelter& sh : shelters) {
+                    if (sh.capacityOccupied > sh.capacityTotal) overCapacity = true;
+                }
+                
+                cout << "\n" << threads << " workers, " << fixed << setprecision(2) << ms << " ms\n";
+                printSuccess("Placed " + to_string(placed) + " of " + to_string(results.size()) + " persons");
+                if (overCapacity) {
+                    printError("A shelter is over capacity!");
+                } else {
+                    printSuccess("No shelter over capacity");
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 8: {
+                clearScreen();
+                printSubHeader("Bed Reservation Stress Test");
+                
+                int threads = max(8u, 2 * thread::hardware_concurrency());
+                const int claimsPerThread = 200000;
+                cout << threads << " threads x " << claimsPerThread << " claims/releases over 16 shelters\n\n";
+                
+                auto start = chrono::steady_clock::now();
+                bool ok = bedReservationStressTest(16, threads, claimsPerThread);
+                double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+                
+                cout << "\nFinished in " << fixed << setprecision(1) << ms << " ms\n";
+                if (ok) {
+                    printSuccess("No over-allocation: every bed accounted for");
+                } else {
+                    printError("Over-allocation detected!");
+                }
+                
+                const int side = 60;
+                cout << "\nConcurrent intake on a " << side << "x" << side << " grid (" << side * side 
+                     << " intersections), two operators at once:\n\n";
+                if (intakeGridSelfTest(side, 10, max(2u, thread::hardware_concurrency()))) {
+                    printSuccess("No shelter over capacity after any intake");
+                } else {
+                    printError("Intake left a shelter over capacity or miscounted!");
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 9: {
+                clearScreen();
+                printSubHeader("Outreach Sweep at Location");
+                
+                int node;
+                cout << "Enter Location Node ID: ";
+                cin >> node;
+                cin.ignore();
+                
+                vector<int> waiting;
+                for (int handle : personsAtNode(node)) {
+                    if (!personAt(handle).allocated) waiting.push_back(handle);
+                }
+                sort(waiting.begin(), waiting.end(), [](int a, int b) {
+                    return personAt(a).priorityScore > personAt(b).priorityScore;
+                });
+                
+                if (waiting.empty()) {
+                    printInfo("Nobody awaiting a shelter at node " + to_string(node));
+                } else {
+                    cout << left << setw(6) << "ID" << setw(20) << "Name" << setw(12) << "Priority" 
+                         << setw(30) << "Complaint\n";
+                    cout << string(68, '-') << "\n";
+                    for (int handle : waiting) {
+                        const Homeless& h = personAt(handle);
+                        cout << left << setw(6) << h.id << setw(20) << h.name.substr(0, 18) 
+                             << setw(12) << h.priorityScore 
+                             << setw(30) << h.complaint.substr(0, 28) << "\n";
+                    }
+                    cout << "\n" << waiting.size() << " awaiting allocation here (" 
+                         << personsAtNode(node).size() << " registered at this node, " 
+                         << unallocatedPersons().size() << " waiting citywide)\n";
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 10: {
+                clearScreen();
+                printSubHeader("Batch Allocation Self-Test");
+                
+                int rounds;
+                cout << "Number of random instances (e.g. 300): ";
+                cin >> rounds;
+                
+                if (rounds < 1 || rounds > 100000) {
+                    printError("Instance count must be between 1 and 100000");
+                } else {
+                    cout << "\nMin-cost flow plans checked against Bellman-Ford successive shortest paths:\n";
+                    if (batchAllocationSelfTest(rounds)) {
+                        printSuccess("Every plan houses the most persons by priority at minimum cost");
+                    } else {
+                        printError("Batch plans differ from the reference!");
+                    }
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            default:
+                printError("Invalid choice");
+                pressEnterToContinue();
+        }
+    }
+}
+
+// ==================== SUBSYSTEM 4: ANALYSIS & REPORTING ====================
+
+void analysisReportingMenu() {
+    while (true) {
+        clearScreen();
+        printHeader("ANALYSIS & REPORTING SUBSYSTEM");
+        
+        cout << "\n1. Generate Daily Report\n";
+        cout << "2. Shelter Utilization Analysis\n";
+        cout << "3. Overcrowding Alert Check\n";
+        cout << "4. Complaint Category Analysis\n";
+        cout << "5. Priority Distribution Report\n";
+        cout << "6. Allocation Efficiency Report\n";
+        cout << "7. Network Analysis Report\n";
+        cout << "8. Benchmark Report Scans (Map vs Columns)\n";
+        cout << "9. Benchmark Complaint Keyword Scan (MB/s)\n";
+        cout << "10. Reload Complaint Keyword Rules (" << COMPLAINT_RULES_FILE << ")\n";
+        cout << "11. Export Current Keyword Rules\n";
+        cout << "0. Back to Main Menu\n";
+        cout << "\n" << CYAN << "Enter choice: " << RESET;
+        
+        int choice;
+        cin >> choice;
+        cin.ignore();
+        
+        if (choice == 0) break;
+        
+        switch (choice) {
+            case 1: {
+                clearScreen();
+                printSubHeader("Daily Summary Report");
+                
+                PersonSummary sum = summarizePersons(personColumns);
+                int totalReg = sum.total;
+                int totalAllocated = sum.allocated;
+                int totalMedical = sum.medical;
+                int totalChildren = sum.children;
+                
+                int totalCap = 0, totalOcc = 0;
+                for (const Shelter& s : shelters) {
+                    totalCap += s.capacityTotal;
+                    totalOcc += s.capacityOccupied;
+                }
+                
+                cout << "╔════════════════════════════════════════╗\n";
+                cout << "║         DAILY OPERATIONS REPORT        ║\n";
+                cout << "╚════════════════════════════════════════╝\n\n";
+                
+                cout << BOLD << "Population Statistics:" << RESET << "\n";
+                cout << "  Total Registered: " << totalReg << "\n";
+                cout << "  Allocated to Shelters: " << totalAllocated << " (" 
+                     << (totalReg > 0 ? (totalAllocated*100)/totalReg : 0) << "%)\n";
+                cout << "  Awaiting Allocation: " << (totalReg - totalAllocated) << "\n";
+                cout << "  Medical Cases: " << totalMedical << "\n";
+                cout << "  Children (<18): " << totalChildren << "\n\n";
+                
+                cout << BOLD << "Shelter Statistics:" << RESET << "\n";
+                cout << "  Total Shelters: " << shelters.size() << "\n";
+                cout << "  Total Capacity: " << totalCap << " beds\n";
+                cout << "  Currently Occupied: " << totalOcc << " beds\n";
+                cout << "  Available: " << (totalCap - totalOcc) << " beds\n";
+                cout << "  Utilization Rate: " << fixed << setprecision(1) 
+                     << (totalCap > 0 ? (totalOcc*100.0)/totalCap : 0) << "%\n\n";
+                
+                cout << BOLD << "Emergency Queue:" << RESET << "\n";
+                cout << "  Pending Cases: " << emergencyHeap.size() << "\n\n";
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 2: {
+                clearScreen();
+                printSubHeader("Shelter Utilization Analysis");
+                
+                cout << left << setw(25) << "Shelter" << setw(15) << "Utilization" 
+                     << setw(15) << "Status" << setw(15) << "Action\n";
+                cout << string(70, '-') << "\n";
+                
+                for (const Shelter& s : shelters) {
+                    double util = s.capacityTotal > 0 ? (s.capacityOccupied * 100.0) / s.capacityTotal : 100.0;
+                    string status, action;
+                    
+                    if (util >= 90) {
+                        status = RED "CRITICAL" RESET;
+                        action = "Add capacity";
+                    } else if (util >= 75) {
+                        status = YELLOW "HIGH" RESET;
+                        action = "Monitor";
+                    } else if (util >= 50) {
+                        status = GREEN "NORMAL" RESET;
+                        action = "None";
+                    } else {
+                        status = BLUE "LOW" RESET;
+                        action = "Redirect";
+                    }
+                    
+                    cout << left << setw(25) << s.name << setw(15) << (to_string((int)util) + "%") 
+                         << setw(15) << status << setw(15) << action << "\n";
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 3: {
+                clearScreen();
+                printSubHeader("Overcrowding Alert System");
+                
+                bool criticalFound = false;
+                for (const Shelter& s : shelters) {
+                    double util = s.capacityTotal > 0 ? (s.capacityOccupied * 100.0) / s.capacityTotal : 100.0;
+                    if (util >= 90) {
+                        cout << RED << "🚨 CRITICAL: " << RESET << s.name 
+                             << " is at " << fixed << setprecision(1) << util << "% capacity!\n";
+                        criticalFound = true;
+                    }
+                }
+                
+                if (!criticalFound) {
+                    printSuccess("No overcrowding detected - all shelters within limits");
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 4: {
+                clearScreen();
+                printSubHeader("Complaint Category Analysis (Aho-Corasick)");
+                
+                unordered_map<string, int> categoryCount;
+                
+                for (int handle : personColumns.handle) {
+                    string category = classifyComplaint(personAt(handle).complaint);
+                    categoryCount[category]++;
+                }
+                
+                cout << left << setw(20) << "Category" << setw(10) << "Count" << setw(15) << "Percentage\n";
+                cout << string(45, '-') << "\n";
+                
+                int total = personColumns.handle.size();
+                for (const auto& cat : categoryCount) {
+                    double pct = (cat.second * 100.0) / total;
+                    cout << left << setw(20) << cat.first << setw(10) << cat.second 
+                         << setw(15) << (to_string((int)pct) + "%") << "\n";
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 5: {
+                clearScreen();
+                printSubHeader("Priority Distribution Report");
+                
+                PersonSummary sum = summarizePersons(personColumns);
+                int low = sum.priorityBand[0], medium = sum.priorityBand[1];
+                int high = sum.priorityBand[2], critical = sum.priorityBand[3];
+                
+                cout << left << setw(20) << "Priority Level" << setw(10) << "Count" << setw(15) << "Percentage\n";
+                cout << string(45, '-') << "\n";
+                
+                int total = sum.total;
+                cout << left << setw(20) << RED "Critical (100+)" << RESET << setw(10) << critical 
+                     << setw(15) << (total > 0 ? to_string((critical*100)/total) + "%" : "0%") << "\n";
+                cout << left << setw(20) << YELLOW "High (70-99)" << RESET << setw(10) << high 
+                     << setw(15) << (total > 0 ? to_string((high*100)/total) + "%" : "0%") << "\n";
+                cout << left << setw(20) << "Medium (40-69)" << setw(10) << medium 
+                     << setw(15) << (total > 0 ? to_string((medium*100)/total) + "%" : "0%") << "\n";
+                cout << left << setw(20) << "Low (0-39)" << setw(10) << low 
+                     << setw(15) << (total > 0 ? to_string((low*100)/total) + "%" : "0%") << "\n";
+                
+                if (total > 0) {
+                    cout << "\nMedian priority: " << kthHighestPriority((total + 1) / 2) << "\n";
+                    cout << "Top 10% threshold: " << kthHighestPriority(max(1, total / 10)) << "\n";
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 6: {
+                clearScreen();
+                printSubHeader("Allocation Efficiency Report");
+                
+                PersonSummary sum = summarizePersons(personColumns);
+                int totalReg = sum.total;
+                int allocated = sum.allocated;
+                int highPriorityAllocated = sum.highPriorityAllocated;
+                int highPriorityTotal = sum.highPriority;
+                
+                cout << "Overall Allocation Rate: " << (totalReg > 0 ? (allocated*100)/totalReg : 0) << "%\n";
+                cout << "High Priority Allocation: " << (highPriorityTotal > 0 ? (highPriorityAllocated*100)/highPriorityTotal : 0) << "%\n";
+                
+                // Waiting persons whose road component holds no shelter cannot
+                // be placed however many beds free up
+                const ComponentLabels& labels = roadComponents();
+                vector<bool> hasShelter(labels.componentSize.size(), false);
+                for (const Shelter& s : shelters) hasShelter[labels.componentOf[s.nodeID]] = true;
+                int cutOff = 0;
+                for (int handle : unallocatedPersons()) {
+                    if (!hasShelter[labels.componentOf[personAt(handle).locationNodeID]]) cutOff++;
+                }
+                cout << "Waiting With No Reachable Shelter: " << cutOff << "\n\n";
+                
+                cout << "Efficiency Rating: ";
+                double efficiency = totalReg > 0 ? (allocated*100.0)/totalReg : 0;
+                if (efficiency >= 90) cout << GREEN << "EXCELLENT" << RESET << "\n";
+                else if (efficiency >= 75) cout << GREEN << "GOOD" << RESET << "\n";
+                else if (efficiency >= 50) cout << YELLOW << "AVERAGE" << RESET << "\n";
+                else cout << RED << "NEEDS IMPROVEMENT" << RESET << "\n";
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 7: {
+                clearScreen();
+                printSubHeader("Network Analysis Report");
+                
+                cout << "Graph Statistics:\n";
+                cout << "  Total Nodes: " << nodeCount << "\n";
+                cout << "  Stations: " << stations.size() << "\n";
+                cout << "  Shelters: " << shelters.size() << "\n\n";
+                
+                cout << "Labelling road components with union-find...\n";
+                checkShelterConnectivity();
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 8: {
+                clearScreen();
+                int count;
+                cout << "Number of synthetic records (e.g. 1000000): ";
+                cin >> count;
+                cin.ignore();
+                
+                if (count <= 0) {
+                    printError("Record count must be positive");
+                } else {
+                    benchmarkPersonScans(count);
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 9: {
+                clearScreen();
+                int count;
+                cout << "Number of synthetic complaints (e.g. 1000000): ";
+                cin >> count;
+                cin.ignore();
+                
+                if (count <= 0) {
+                    printError("Complaint count must be positive");
+                } else {
+                    benchmarkKeywordScan(count);
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 10: {
+                clearScreen();
+                printSubHeader("Reload Complaint Keyword Rules");
+                
+                ComplaintRules loaded;
+                string error;
+                auto start = chrono::steady_clock::now();
+                if (!loadComplaintRules(COMPLAINT_RULES_FILE, loaded, error)) {
+                    printError("Rules not loaded: " + error);
+                    printInfo("The current rules stay in force (option 11 writes them out to edit)");
+                } else {
+                    applyComplaintRules(loaded);
+                    double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+                    printSuccess("Loaded " + to_string(loaded.rules.size()) + " keywords in " + 
+                                 to_string(loaded.categoryNames.size()) + " categories");
+                    
+                    // Scores depend on the rules, so bring every record in line
+                    int changed = 0;
+                    forEachPerson([&](Homeless& h) {
+                        int before = h.priorityScore;
+                        if (calculatePriority(h) != before) changed++;
+                        onPersonChanged(h.id);
+                    });
+                    cout << "Compiled in " << fixed << setprecision(2) << ms << " ms; " 
+                         << changed << " of " << personCount() << " priority scores changed\n";
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 11: {
+                clearScreen();
+                printSubHeader("Export Current Keyword Rules");
+                
+                activeComplaintMatcher();
+                if (saveComplaintRules(COMPLAINT_RULES_FILE, complaintRules)) {
+                    printSuccess(to_string(complaintRules.rules.size()) + " rules written to " + COMPLAINT_RULES_FILE);
+                } else {
+                    printError("Could not write " + COMPLAINT_RULES_FILE);
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            default:
+                printError("Invalid choice");
+                pressEnterToContinue();
+        }
+    }
+}
+
+// ==================== SUBSYSTEM 5: NETWORK & TRAVERSAL ====================
+
+// GRAPH LAYOUT BENCHMARK - adjacency list vs CSR on a synthetic city grid
+void benchmarkGraphLayouts() {
+    printSubHeader("Benchmark: Adjacency List vs CSR Layout");
+    
+    int side;
+    cout << "Grid side length (e.g. 300 for 90,000 intersections): ";
+    cin >> side;
+    cin.ignore();
+    
+    if (side < 2 || side > 3000) {
+        printError("Side length must be between 2 and 3000");
+        return;
+    }
+    
+    int n = side * side;
+    mt19937 rng(42);
+    vector<vector<Edge>> adj = buildGridCity(side, 4, 12, rng);
+    
+    auto t0 = chrono::steady_clock::now();
+    CSRGraph csr = buildCSR(adj);
+    auto t1 = chrono::steady_clock::now();
+    
+    const int runs = 5;
+    vector<int> sources;
+    for (int i = 0; i < runs; i++) sources.push_back(rng() % n);
+    
+    long long checksumAdj = 0, checksumCSR = 0;
+    auto t2 = chrono::steady_clock::now();
+    for (int src : sources) checksumAdj += dijkstraAdjacency(adj, src)[n - 1];
+    auto t3 = chrono::steady_clock::now();
+    for (int src : sources) checksumCSR += dijkstraBinaryHeap(csr, src)[n - 1];
+    auto t4 = chrono::steady_clock::now();
+    
+    double buildMs = chrono::duration<double, milli>(t1 - t0).count();
+    double adjMs = chrono::duration<double, milli>(t3 - t2).count() / runs;
+    double csrMs = chrono::duration<double, milli>(t4 - t3).count() / runs;
+    
+    cout << "\nNodes: " << n << ", Directed edges: " << csr.edgeCount << "\n";
+    cout << "CSR build time: " << fixed << setprecision(2) << buildMs << " ms\n\n";
+    
+    cout << left << setw(20) << "Layout" << setw(20) << "Dijkstra (ms/run)" << "\n";
+    cout << string(40, '-') << "\n";
+    cout << left << setw(20) << "Adjacency list" << setw(20) << adjMs << "\n";
+    cout << left << setw(20) << "CSR" << setw(20) << csrMs << "\n\n";
+    
+    if (checksumAdj != checksumCSR) {
+        printError("Layouts disagree on distances!");
+    } else {
+        printSuccess("Both layouts agree; CSR speedup: " + to_string(adjMs / csrMs).substr(0, 4) + "x");
+    }
+}
+
+// DIJKSTRA QUEUE BENCHMARK - binary heap vs Dial buckets vs radix heap
+// Runs the same grid with growing weight ranges to show where buckets stop paying off.
+void benchmarkQueueStrategies() {
+    printSubHeader("Benchmark: Dijkstra Queue Strategies");
+    
+    int side;
+    cout << "Grid side length (e.g. 300 for 90,000 intersections): ";
+    cin >> side;
+    cin.ignore();
+    
+    if (side < 2 || side > 3000) {
+        printError("Side length must be between 2 and 3000");
+        return;
+    }
+    
+    const int runs = 3;
+    const int maxWeights[] = {12, 100, 1000, 10000, 100000};
+    const char* names[] = {"Binary heap", "Dial", "Radix heap"};
+    const QueueStrategy strategies[] = {QUEUE_BINARY_HEAP, QUEUE_DIAL, QUEUE_RADIX_HEAP};
+    
+    cout << "\nNodes: " << side * side << ", times in ms per run\n\n";
+    cout << left << setw(14) << "Max weight" << setw(14) << names[0] << setw(14) << names[1] 
+         << setw(14) << names[2] << setw(14) << "Fastest" << "\n";
+    cout << string(70, '-') << "\n";
+    
+    bool agree = true;
+    for (int maxWeight : maxWeights) {
+        mt19937 rng(42);
+        CSRGraph csr = buildCSR(buildGridCity(side, 1, maxWeight, rng));
+        vector<int> sources;
+        for (int i = 0; i < runs; i++) sources.push_back(rng() % csr.nodes());
+        
+        double ms[3];
+        long long checksum[3];
+        for (int k = 0; k < 3; k++) {
+            checksum[k] = 0;
+            auto start = chrono::steady_clock::now();
+            for (int src : sources) checksum[k] += dijkstraCSR(csr, src, strategies[k]).back();
+            auto stop = chrono::steady_clock::now();
+            ms[k] = chrono::duration<double, milli>(stop - start).count() / runs;
+        }
+        if (checksum[0] != checksum[1] || checksum[0] != checksum[2]) agree = false;
+        
+        int fastest = min_element(ms, ms + 3) - ms;
+        cout << left << setw(14) << maxWeight << fixed << setprecision(2) 
+             << setw(14) << ms[0] << setw(14) << ms[1] << setw(14) << ms[2] 
+             << setw(14) << names[fastest] << "\n";
+    }
+    
+    cout << "\nQUEUE_AUTO uses Dial up to weight " << DIAL_MAX_WEIGHT << ", radix heap above\n";
+    if (agree) {
+        printSuccess("All strategies agree on distances");
+    } else {
+        printError("Strategies disagree on distances!");
+    }
+}
+
+void networkTraversalMenu() {
+    while (true) {
+        clearScreen();
+        printHeader("NETWORK & TRAVERSAL SUBSYSTEM");
+        
+        cout << "\n1. BFS Traversal from Station\n";
+        cout << "2. Network Connectivity (Union-Find)\n";
+        cout << "3. Shortest Path Analysis (Dijkstra)\n";
+        cout << "4. View Network Topology\n";
+        cout << "5. Find Nearest Available Shelters to Node\n";
+        cout << "6. Benchmark Graph Layouts (Adjacency vs CSR)\n";
+        cout << "7. Benchmark Dijkstra Queue Strategies\n";
+        cout << "8. Update or Close Road\n";
+        cout << "9. Station Routes to Shelters\n";
+        cout << "10. Outreach Sweep Within Distance\n";
+        cout << "11. Load City Data from Files\n";
+        cout << "12. Save Road Network as Binary\n";
+        cout << "0. Back to Main Menu\n";
+        cout << "\n" << CYAN << "Enter choice: " << RESET;
+        
+        int choice;
+        cin >> choice;
+        cin.ignore();
+        
+        if (choice == 0) break;
+        
+        switch (choice) {
+            case 1: {
+                clearScreen();
+                cout << "Available Stations:\n";
+                for (const Station& st : stations) {
+                    cout << "  " << st.name << " (Node " << st.nodeID << ")\n";
+                }
+                
+                int nodeID, maxHops;
+                cout << "\nEnter Node ID to start BFS: ";
+                cin >> nodeID;
+                cout << "Maximum hops (-1 for whole network): ";
+                cin >> maxHops;
+                cin.ignore();
+                
+                traverseNearbyAreas(nodeID, maxHops);
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 2: {
+                clearScreen();
+                checkShelterConnectivity();
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 3: {
+                clearScreen();
+                printSubHeader("Shortest Path Analysis");
+                
+                int source;
+                cout << "Enter source node (0-" << nodeCount - 1 << "): ";
+                cin >> source;
+                cin.ignore();
+                
+                if (source < 0 || source >= nodeCount) {
+                    printError("Invalid node");
+                } else {
+                    // Station trees are already cached; anything else goes to the hierarchy
+                    bool cached = distanceTrees.count(source) > 0;
+                    cout << (cached ? "\nReading the cached station route tree...\n\n" 
+                                    : "\nQuerying the contraction hierarchy...\n\n");
+                    
+                    cout << left << setw(20) << "Destination" << setw(12) << "Distance" << "Route\n";
+                    cout << string(60, '-') << "\n";
+                    
+                    for (const Shelter& s : shelters) {
+                        vector<int> route;
+                        int dist;
+                        if (cached) {
+                            const ShortestPathTree& tree = cachedDistanceTree(source);
+                            dist = tree.dist[s.nodeID];
+                            route = reconstructRoute(tree, s.nodeID);
+                        } else {
+                            dist = chShortestPath(source, s.nodeID, &route);
+                        }
+                        cout << left << setw(20) << s.name 
+                             << setw(12) << (dist == INT_MAX ? "Unreachable" : to_string(dist)) 
+                             << (dist == INT_MAX ? "-" : formatRoute(route)) << "\n";
+                    }
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 4: {
+                clearScreen();
+                printSubHeader("Network Topology");
+                
+                cout << "Stations:\n";
+                for (const Station& st : stations) {
+                    cout << "  • " << st.name << " at Node " << st.nodeID << "\n";
+                }
+                
+                cout << "\nShelters:\n";
+                for (const Shelter& s : shelters) {
+                    cout << "  • " << s.name << " at Node " << s.nodeID 
+                         << " (Capacity: " << s.capacityOccupied << "/" << s.capacityTotal << ")\n";
+                }
+                
+                cout << "\nTotal Graph Nodes: " << nodeCount << "\n";
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 5: {
+                clearScreen();
+                printSubHeader("Find Nearest Available Shelters");
+                
+                int nodeID, k;
+                cout << "Enter node ID: ";
+                cin >> nodeID;
+                cout << "How many shelters (k): ";
+                cin >> k;
+                cin.ignore();
+                
+                if (nodeID < 0 || nodeID >= nodeCount) {
+                    printError("Invalid node");
+                } else if (k < 1) {
+                    printError("k must be at least 1");
+                } else {
+                    NearestShelterResult nearest = nearestAvailableShelters(nodeID, k);
+                    
+                    if (nearest.shelters.empty()) {
+                        printError("No shelter with free beds is reachable");
+                    } else {
+                        cout << "\n" << left << setw(6) << "Rank" << setw(25) << "Shelter" 
+                             << setw(12) << "Distance" << setw(12) << "Available" << "\n";
+                        cout << string(55, '-') << "\n";
+                        
+                        for (int i = 0; i < nearest.shelters.size(); i++) {
+                            const Shelter* s = findShelter(nearest.shelters[i].shelterID);
+                            cout << left << setw(6) << (i + 1) << setw(25) << s->name 
+                                 << setw(12) << nearest.shelters[i].distance 
+                                 << setw(12) << freeBeds(*s) << "\n";
+                        }
+                    }
+                    
+                    cout << "\nSearch settled " << nearest.nodesSettled << " of " << nodeCount << " nodes\n";
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 6: {
+                clearScreen();
+                benchmarkGraphLayouts();
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 7: {
+                clearScreen();
+                benchmarkQueueStrategies();
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 8: {
+                clearScreen();
+                printSubHeader("Update or Close Road");
+                
+                int u, v, weight;
+                cout << "Enter first node: ";
+                cin >> u;
+                cout << "Enter second node: ";
+                cin >> v;
+                
+                if (u < 0 || u >= nodeCount || v < 0 || v >= nodeCount || u == v) {
+                    cin.ignore();
+                    printError("Invalid node");
+                } else {
+                    int current = roadLength(u, v);
+                    cout << "Current length: " << (current < 0 ? "no road" : to_string(current)) << "\n";
+                    cout << "Enter new length (-1 to close): ";
+                    cin >> weight;
+                    cin.ignore();
+                    
+                    if (weight < 0 && current < 0) {
+                        printWarning("There is no road to close");
+                    } else {
+                        RoadUpdateStats stats = updateRoad(u, v, weight);
+                        printSuccess(weight < 0 ? "Road closed" : "Road length set to " + to_string(weight));
+                        cout << "  Cached distance trees: " << distanceTrees.size() 
+                             << " (" << stats.treeNodesRepaired << " nodes repaired)\n";
+                        cout << "  Shelter catchment: " << stats.catchmentNodesReranked << " nodes re-ranked\n";
+                        printInfo("Route hierarchy is being rebuilt in the background");
+                    }
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 9: {
+                clearScreen();
+                printSubHeader("Station Routes to Shelters");
+                
+                for (const Station& st : stations) {
+                    const ShortestPathTree& tree = cachedDistanceTree(st.nodeID);
+                    
+                    cout << "\n" << BOLD << st.name << RESET << " (Node " << st.nodeID << ")\n";
+                    cout << string(60, '-') << "\n";
+                    
+                    for (const Shelter& s : shelters) {
+                        vector<int> route = reconstructRoute(tree, s.nodeID);
+                        cout << "  " << left << setw(20) << s.name;
+                        if (route.empty()) {
+                            cout << RED << "Unreachable" << RESET << "\n";
+                        } else {
+                            cout << setw(8) << tree.dist[s.nodeID] << formatRoute(route) << "\n";
+                        }
+                    }
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 10: {
+                clearScreen();
+                printSubHeader("Outreach Sweep Within Distance");
+                
+                int nodeID, radius;
+                cout << "Enter start node: ";
+                cin >> nodeID;
+                cout << "Enter maximum road distance: ";
+                cin >> radius;
+                cin.ignore();
+                
+                if (nodeID < 0 || nodeID >= nodeCount || radius < 0) {
+                    printError("Invalid node or distance");
+                } else {
+                    SweepResult sweep = sweepWithinDistance(nodeID, radius);
+                    cout << "\nNodes within " << radius << " units (nearest first): ";
+                    for (int i = 0; i < sweep.nodes.size(); i++) {
+                        cout << sweep.nodes[i] << (i + 1 < sweep.nodes.size() ? ", " : "\n");
+                    }
+                    printSuccess(to_string(sweep.nodes.size()) + " nodes in sweep area");
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 11: {
+                clearScreen();
+                printSubHeader("Load City Data from Files");
+                
+                string graphPath, facilitiesPath;
+                cout << "Road network file (DIMACS, edge list or binary): ";
+                getline(cin, graphPath);
+                cout << "Shelters/stations file (blank keeps current): ";
+                getline(cin, facilitiesPath);
+                
+                long memoryBefore = residentMemoryKB();
+                auto start = chrono::steady_clock::now();
+                bool binary = false;
+                bool loaded = loadCityData(graphPath, facilitiesPath, binary);
+                double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+                
+                if (!loaded) {
+                    printError("Could not load city data (missing file, bad format, or facilities off the network)");
+                } else {
+                    warmStationTrees();
+                    cout << "\nNodes: " << nodeCount << "   Roads: " << roadNetwork().edgeCount << "\n";
+                    cout << "Format: " << (binary ? "binary (memory-mapped)" : "text (streamed)") << "\n";
+                    cout << "Load time: " << fixed << setprecision(2) << ms << " ms\n";
+                    if (memoryBefore >= 0) {
+                        cout << "Resident memory: " << memoryBefore << " KB -> " << residentMemoryKB() << " KB\n";
+                    }
+                    printSuccess("Loaded " + to_string(shelters.size()) + " shelters and " 
+                                 + to_string(stations.size()) + " stations");
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            case 12: {
+                clearScreen();
+                printSubHeader("Save Road Network as Binary");
+                
+                string path;
+                cout << "Output file: ";
+                getline(cin, path);
+                
+                if (saveBinaryGraph(roadNetwork(), path)) {
+                    printSuccess("Saved " + to_string(nodeCount) + " nodes to " + path);
+                } else {
+                    printError("Could not write " + path);
+                }
+                
+                pressEnterToContinue();
+                break;
+            }
+            
+            default:
+                printError("Invalid choice");
+                pressEnterToContinue();
+        }
+    }
+}
+
+// ==================== INITIALIZATION ====================
+
+void initializeSampleData() {
+    nodeCount = 15;
+    graph.resize(nodeCount);
+    
+    // Build graph
+    graph[0] = {{1, 5}, {2, 10}};
+    graph[1] = {{0, 5}, {3, 7}, {4, 12}};
+    graph[2] = {{0, 10}, {5, 8}};
+    graph[3] = {{1, 7}, {6, 6}};
+    graph[4] = {{1, 12}, {7, 9}};
+    graph[5] = {{2, 8}, {8, 11}};
+    graph[6] = {{3, 6}, {9, 4}};
+    graph[7] = {{4, 9}, {10, 7}};
+    graph[8] = {{5, 11}, {11, 5}};
+    graph[9] = {{6, 4}, {12, 8}};
+    graph[10] = {{7, 7}, {13, 6}};
+    graph[11] = {{8, 5}, {14, 10}};
+    graph[12] = {{9, 8}};
+    graph[13] = {{10, 6}};
+    graph[14] = {{11, 10}};
+    onRoadGraphChanged();
+    
+    // Stations
+    stations = {
+        {1, "Central Railway Station", 0},
+        {2, "East Junction", 3},
+        {3, "West Terminal", 6}
+    };
+    
+    // Shelters
+    shelters = {
+        {1, "Hope Shelter", 4, 50, 35, "9876543210", {}},
+        {2, "Care Center", 7, 40, 28, "9876543211", {}},
+        {3, "Safe Haven", 10, 60, 45, "9876543212", {}},
+        {4, "Community Home", 13, 30, 15, "9876543213", {}}
+    };
+    onSheltersReplaced();
+    
+    // Sample homeless records
+    vector<Homeless> samples = {
+        {101, "Ramesh Kumar", 45, "Male", 0, false, 0, "Need food urgently", time(0), false, -1},
+        {102, "Lakshmi Devi", 65, "Female", 1, true, 0, "Medical help needed", time(0), false, -1},
+        {103, "Anita", 8, "Female", 2, false, 0, "Child alone, scared", time(0), false, -1},
+        {104, "Suresh", 32, "Male", 3, false, 0, "Looking for shelter", time(0), false, -1},
+        {105, "Meera", 70, "Female", 5, true, 0, "Emergency medical case", time(0), false, -1}
+    };
+    
+    for (Homeless& h : samples) {
+        calculatePriority(h);
+        int handle = insertPerson(h);
+        if (handle >= 0) {
+            refreshPersonIndexes(handle);
+            refreshPersonText(handle);
+        }
+        
+        if (h.priorityScore > 80) {
+            emergencyHeap.push({h.id, h.priorityScore, time(0)});
+        }
+    }
+}
+
+// ==================== MAIN MENU ====================
+
+void displayMainMenu() {
+    clearScreen();
+    printHeader("SMART HOMELESS SHELTER MANAGEMENT SYSTEM");
+    
+    cout << BOLD << "\n┌─────────────────────────────────────────────────────────┐\n";
+    cout << "│                    MAIN MENU - SUBSYSTEMS               │\n";
+    cout << "└─────────────────────────────────────────────────────────┘\n" << RESET;
+    
+    cout << "\n" << CYAN << "1. 📋 Registration & Data Management" << RESET;
+    cout << "\n     » Register, search, update homeless records";
+    cout << "\n     » Uses: Hashing, Binary Search, MinHash/LSH, Inverted Index\n";
+    
+    cout << "\n" << GREEN << "2. 🏠 Shelter Allocation & Management" << RESET;
+    cout << "\n     » Allocate shelters, manage capacity";
+    cout << "\n     » Uses: Dijkstra's Algorithm, Merge Sort, Union-Find\n";
+    
+    cout << "\n" << RED << "3. 🚨 Emergency Management" << RESET;
+    cout << "\n     » Handle emergency cases with priority";
+    cout << "\n     » Uses: Max Heap, Priority Queue\n";
+    
+    cout << "\n" << YELLOW << "4. 📊 Analysis & Reporting" << RESET;
+    cout << "\n     » Generate reports, analyze utilization";
+    cout << "\n     » Uses: Aho-Corasick, Statistical Analysis\n";
+    
+    cout << "\n" << BLUE << "5. 🗺️  Network & Traversal" << RESET;
+    cout << "\n     » BFS traversal, connectivity, shortest paths";
+    cout << "\n     » Uses: BFS, Union-Find, Dijkstra\n";
+    
+    cout << "\n" << MAGENTA << "6. ℹ️  System Information" << RESET;
+    cout << "\n     » View algorithms, complexities, credits\n";
+    
+    cout << "\n0. ❌ Exit System\n";
+    
+    cout << "\n" << BOLD << CYAN << "═══════════════════════════════════════════════════════════\n";
+    cout << "Enter your choice: " << RESET;
+}
+
+void displaySystemInfo() {
+    clearScreen();
+    printHeader("SYSTEM INFORMATION");
+    
+    cout << "\n" << BOLD << "🧠 ALGORITHMS IMPLEMENTED:\n" << RESET;
+    cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n\n";
+    
+    cout << "1.  " << GREEN << "Dijkstra's Algorithm" << RESET << "\n";
+    cout << "    Purpose: Shortest path for shelter allocation\n";
+    cout << "    Complexity: O((V+E) log V)\n\n";
+    
+    cout << "2.  " << GREEN << "Breadth-First Search (BFS)" << RESET << "\n";
+    cout << "    Purpose: Nearby area traversal\n";
+    cout << "    Complexity: O(V + E)\n\n";
+    
+    cout << "3.  " << GREEN << "Union-Find Component Labelling" << RESET << "\n";
+    cout << "    Purpose: Network connectivity check, one label per road component\n";
+    cout << "    Complexity: O((V + E) α(V))\n\n";
+    
+    cout << "4.  " << GREEN << "Hashing" << RESET << "\n";
+    cout << "    Purpose: Fast record storage/retrieval\n";
+    cout << "    Complexity: O(1) average case\n\n";
+    
+    cout << "5.  " << GREEN << "Binary Search" << RESET << "\n";
+    cout << "    Purpose: Efficient ID search\n";
+    cout << "    Complexity: O(log n)\n\n";
+    
+    cout << "6.  " << GREEN << "Merge Sort" << RESET << "\n";
+    cout << "    Purpose: Rank shelters by beds, utilization, distance\n";
+    cout << "    Complexity: O(n log n)\n\n";
+    
+    cout << "7.  " << GREEN << "Max Heap (Priority Queue)" << RESET << "\n";
+    cout << "    Purpose: Emergency prioritization\n";
+    cout << "    Complexity: O(log n) insert/extract\n\n";
+    
+    cout << "8.  " << GREEN << "Aho-Corasick Automaton" << RESET << "\n";
+    cout << "    Purpose: All complaint keywords in one pass\n";
+    cout << "    Complexity: O(n) per complaint\n\n";
+    
+    cout << "9.  " << GREEN << "Multi-source K-nearest Dijkstra" << RESET << "\n";
+    cout << "    Purpose: Shelter catchment table for allocation\n";
+    cout << "    Complexity: O(K (V+E) log V) build, O(1) lookup\n\n";
+    
+    cout << "10. " << GREEN << "Dial's Buckets / Radix Heap" << RESET << "\n";
+    cout << "    Purpose: Integer-weight Dijkstra queues\n";
+    cout << "    Complexity: O(V + E + D) / O(E + V log C)\n\n";
+    
+    cout << "11. " << GREEN << "Contraction Hierarchies" << RESET << "\n";
+    cout << "    Purpose: Fast point-to-point routes\n";
+    cout << "    Complexity: Bidirectional upward search\n\n";
+    
+    cout << "12. " << GREEN << "Min-Cost Flow (Successive Shortest Paths)" << RESET << "\n";
+    cout << "    Purpose: Batch shelter allocation\n";
+    cout << "    Complexity: O(P A log A) with potentials\n\n";
+    
+    cout << "13. " << GREEN << "MinHash + Locality-Sensitive Hashing" << RESET << "\n";
+    cout << "    Purpose: Near-duplicate registration check\n";
+    cout << "    Complexity: O(length) signature, O(bands + candidates) check\n\n";
+    
+    cout << "14. " << GREEN << "Inverted Index (compressed posting lists)" << RESET << "\n";
+    cout << "    Purpose: Find persons by complaint words (AND/OR)\n";
+    cout << "    Complexity: O(sum of posting list sizes) per query\n\n";
+    
+    cout << "\n" << BOLD << "📚 PROJECT DETAILS:\n" << RESET;
+    cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n";
+    cout << "Title: Smart Homeless Shelter Management System\n";
+    cout << "Domain: Social Welfare + Algorithm Optimization\n";
+    cout << "Language: C++ (STL Only)\n";
+    cout << "Features: 5 Major Subsystems, 17+ Algorithms\n";
+    cout << "Purpose: Academic DAA Project\n";
+    
+    pressEnterToContinue();
+}
+
+// Usage: shelter [roadNetworkFile [facilitiesFile]]
+int main(int argc, char* argv[]) {
+    // Initialize system
+    cout << BOLD << CYAN << "\n╔════════════════════════════════════════════════════════╗\n";
+    cout << "║                                                        ║\n";
+    cout << "║     SMART HOMELESS SHELTER MANAGEMENT SYSTEM          ║\n";
+    cout << "║     Design and Analysis of Algorithms Project         ║\n";
+    cout << "║                                                        ║\n";
+    cout << "╚════════════════════════════════════════════════════════╝\n" << RESET;
+    
+    cout << "\n" << YELLOW << "Initializing system..." << RESET << "\n";
+    cout << "  • Loading complaint keyword rules... ";
+    ComplaintRules loadedRules;
+    string rulesError;
+    if (loadComplaintRules(COMPLAINT_RULES_FILE, loadedRules, rulesError)) {
+        applyComplaintRules(loadedRules);
+        cout << GREEN << "✓" << RESET << " " << loadedRules.rules.size() << " from " << COMPLAINT_RULES_FILE << "\n";
+    } else if (ifstream(COMPLAINT_RULES_FILE)) {
+        cout << YELLOW << "⚠ " << rulesError << ", using built-in rules" << RESET << "\n";
+    } else {
+        cout << GREEN << "✓" << RESET << " (built-in)\n";
+    }
+    
+    cout << "  • Loading graph network... ";
+    initializeSampleData();
+    if (argc > 1) {
+        long memoryBefore = residentMemoryKB();
+        auto start = chrono::steady_clock::now();
+        bool binary = false;
+        if (loadCityData(argv[1], argc > 2 ? argv[2] : "", binary)) {
+            double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+            cout << GREEN << "✓" << RESET << " " << nodeCount << " nodes from " << argv[1]
+                 << (binary ? " (mapped, " : " (parsed, ") << fixed << setprecision(1) << ms << " ms";
+            if (memoryBefore >= 0) cout << ", +" << residentMemoryKB() - memoryBefore << " KB resident";
+            cout << ")\n";
+        } else {
+            cout << YELLOW << "⚠ could not load " << argv[1] << ", using sample city" << RESET << "\n";
+        }
+    } else {
+        cout << GREEN << "✓" << RESET << "\n";
+    }
+    
+    cout << "  • Warming station route trees... ";
+    warmStationTrees();
+    cout << GREEN << "✓" << RESET << "\n";
+    
+    cout << "  • Preparing route hierarchy... ";
+    bool fromCache = prepareContractionHierarchy();
+    cout << GREEN << "✓" << RESET << (fromCache ? " (cached)" : " (built)") << "\n";
+    
+    cout << "  • Loading sample data... ";
+    cout << GREEN << "✓" << RESET << "\n";
+    
+    cout << "  • Initializing subsystems... ";
+    cout << GREEN << "✓" << RESET << "\n";
+    
+    cout << "\n" << GREEN << BOLD << "System Ready!" << RESET << "\n";
+    
+    pressEnterToContinue();
+    
+    int choice;
+    do {
+        expireBedHolds();
+        displayMainMenu();
+        cin >> choice;
+        cin.ignore();
+        
+        switch (choice) {
+            case 1:
+                registrationMenu();
+                break;
+            
+            case 2:
+                shelterManagementMenu();
+                break;
+            
+            case 3:
+                emergencyManagementMenu();
+                break;
+            
+            case 4:
+                analysisReportingMenu();
+                break;
+            
+            case 5:
+                networkTraversalMenu();
+                break;
+            
+            case 6:
+                displaySystemInfo();
+                break;
+            
+            case 0:
+                clearScreen();
+                printHeader("THANK YOU");
+                cout << "\n" << GREEN << "System shutting down gracefully...\n";
+                cout << "All data has been processed.\n";
+                cout << "Goodbye! 👋\n" << RESET << "\n";
+                break;
+            
+            default:
+                printError("Invalid choice! Please try again.");
+                pressEnterToContinue();
+        }
+    } while (choice != 0);
+    
+    return 0;
+}
         
\ No newline at end of file